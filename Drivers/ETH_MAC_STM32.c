@@ -61,17 +61,119 @@ __Functional__ deviations:
   - PowerControl:
     - depends on the code generated by CubeMX.
     - low-power mode is not supported by HAL.
-  - SetAddressFilter:
-    - not supported by HAL.
   - GetRxFrameTime:
-    - not supported by HAL.
+    - supported only if PTP is enabled in HAL (**HAL_ETH_USE_PTP** is defined).
   - GetTxFrameTime:
-    - not supported by HAL.
+    - supported only if PTP is enabled in HAL (**HAL_ETH_USE_PTP** is defined).
   - Control:
     - not supported control codes: ARM_ETH_MAC_CONTROL_TX, ARM_ETH_MAC_FLUSH, and ARM_ETH_MAC_SLEEP.
     - for control code ARM_ETH_MAC_VLAN_FILTER the VLAN filter disable is not supported.
   - ControlTimer:
-    - not supported by HAL.
+    - supported only if PTP is enabled in HAL (**HAL_ETH_USE_PTP** is defined).
+    - not supported control code: ARM_ETH_MAC_TIMER_SET_ALARM.
+
+# Driver Specific Features
+
+Driver specific Control codes are defined in the **ETH_MAC_STM32.h** header file.
+
+## Zero-copy Receive
+
+Received frame can be processed directly in the receive DMA buffer, without copying it with **ReadFrame**,
+by loaning the buffer from the driver with Control code **ETH_MAC_STM32_RX_FRAME_LOAN** with arg pointing to
+an **ETH_MAC_STM32_RX_FRAME** structure:
+  - driver sets **data** to the frame in the receive DMA buffer and **len** to the frame length,
+    if no frame is available **data** is set to NULL and **len** to 0
+  - frame that was already sized with **GetRxFrameSize** but not yet read with **ReadFrame** is loaned first
+  - loaned buffer is not used for reception until it is returned with Control code **ETH_MAC_STM32_RX_FRAME_RELEASE**
+    with arg pointing to the same structure, the buffer is then attached to a free receive DMA descriptor
+
+Number of receive DMA buffers is **ETH_RX_DESC_CNT** by default, which means that each loaned buffer leaves
+one receive DMA descriptor without buffer until it is released. To keep all descriptors ready for reception
+while frames are on loan, define **ETH_MAC_RX_BUF_CNT** (up to 32) with the number of receive DMA buffers, for example:
+\code
+#define ETH_MAC_RX_BUF_CNT  (ETH_RX_DESC_CNT + 4U)
+\endcode
+
+> **Notes**
+>
+> - size of the **.driver.eth_mac0_rx_buf** section is **ETH_MAC_RX_BUF_CNT** x **ETH_MAX_PACKET_SIZE** bytes.
+> - frames that do not fit into a single receive DMA buffer are not supported.
+
+## Multicast Address Filtering
+
+**SetAddressFilter** configures the multicast addresses that are received in hardware, so that frames to other
+multicast addresses are rejected by the MAC without enabling **ARM_ETH_MAC_ADDRESS_MULTICAST**:
+  - first 3 addresses are perfect filtered with the additional MAC address registers (MACA1 .. MACA3)
+  - if more addresses are configured, the remaining ones are filtered with the 64-bit multicast hash table,
+    which can also pass some frames to other multicast addresses with the same hash value
+  - num_addr = 0 disables the perfect and hash filters
+  - configured filter is kept when the MAC address is changed with **SetMacAddress**
+
+## Precision Time Protocol (IEEE 1588)
+
+If PTP is enabled in HAL (**HAL_ETH_USE_PTP** is defined), the PTP timestamp unit is configured in **PowerControl**
+(**ARM_POWER_FULL**) and the precision timer is available:
+  - timer runs with nanosecond resolution and fine correction, starting from 0 at power up
+  - **ControlTimer** gets, sets, increments and decrements the time, and adjusts the clock frequency
+    (**ARM_ETH_MAC_TIMER_ADJUST_CLOCK** with time->ns = correction factor x 2^31)
+  - all received frames are timestamped, **GetRxFrameTime** returns the timestamp of the frame sized with
+    **GetRxFrameSize** and not yet read, timestamp of a loaned frame is in **time** member of **ETH_MAC_STM32_RX_FRAME**
+  - frame sent with flag **ARM_ETH_MAC_TX_FRAME_TIMESTAMP** (on the last fragment) is timestamped when transmitted,
+    **GetTxFrameTime** returns the timestamp of the last such frame after its **ARM_ETH_MAC_EVENT_TX_FRAME** event
+    (ARM_DRIVER_ERROR if it was not yet transmitted)
+  - **SetMacAddress** reinitializes the peripheral, which restarts the timer from 0
+
+## Receive Interrupt Coalescing
+
+By default every received frame raises an interrupt and **ARM_ETH_MAC_EVENT_RX_FRAME** event.
+Control code **ETH_MAC_STM32_RX_COALESCE** reduces the interrupt load under high receive rates,
+arg is composed of **ETH_MAC_STM32_RX_COALESCE_FRAMES(n)** and **ETH_MAC_STM32_RX_COALESCE_TIME(us)**:
+  - receive descriptors are built with interrupt on completion only for every n-th frame (n = 1 .. **ETH_RX_DESC_CNT**)
+  - frames without interrupt are signaled by the receive interrupt watchdog at latest us microseconds
+    after reception (required if n is greater than 1, up to 255 x 256 AHB clock cycles)
+  - n = 0 or 1 restores interrupt on every frame (descriptors that were already built keep their setting,
+    so the watchdog stays enabled until all descriptors were built again, even if us = 0)
+  - coalescing is disabled by **PowerControl** (**ARM_POWER_FULL**)
+
+Frames signaled by one event are best fetched in one call with Control code **ETH_MAC_STM32_RX_FRAMES_LOAN**
+with arg pointing to an **ETH_MAC_STM32_RX_FRAMES** structure: up to **max_num** frames are loaned into the
+**frame** array and their number is returned in **num**. They are returned to the driver with Control code
+**ETH_MAC_STM32_RX_FRAMES_RELEASE** with arg pointing to the same structure, which releases **num** frames
+and re-attaches the buffers to the receive DMA descriptors at once.
+
+> **Note**
+>
+> - n should be smaller than the number of receive descriptors with buffer, otherwise reception stalls
+>   until the watchdog expires when the descriptor ring is full.
+
+## Zero-copy Transmit
+
+Frame fragments can be sent directly from the caller's buffers, without copying them to the transmit DMA buffer,
+by calling **SendFrame** with the driver specific flag **ETH_MAC_STM32_TX_FRAME_NO_COPY** (for example a protocol
+header in one buffer and the payload in another buffer, with **ARM_ETH_MAC_TX_FRAME_FRAGMENT** for all but the last one):
+  - fragments of a frame are linked into a buffer chain that is passed to the transmit DMA,
+    fragments sent without the flag are copied into the transmit DMA buffer as before
+  - buffer of a fragment sent without copying must stay unchanged until the driver calls the release callback
+    registered with Control code **ETH_MAC_STM32_SET_TX_RELEASE_CB** (arg = pointer to **ETH_MAC_STM32_TxRelease_t** function),
+    the callback is called from the Ethernet interrupt, once for every such fragment, after the frame was transmitted
+  - frame can consist of up to **ETH_TX_DESC_CNT** buffers, where consecutive copied fragments are merged into one buffer
+  - if **SendFrame** returns an error the frame is discarded and its fragments are not released with the callback
+
+> **Notes**
+>
+> - fragments sent without copying must be located in memory accessible by the Ethernet DMA,
+>   for devices with cache the memory must be **non-cacheable** or data cache must be cleaned before sending.
+> - fragments that were not transmitted yet are released with the callback when the driver is powered off or re-initialized.
+
+## Transmit Descriptor Ring
+
+**SendFrame** queues the frame to the transmit DMA descriptor ring and returns without waiting for the transmission,
+so up to **ETH_TX_DESC_CNT** frames can be in flight for back-to-back transmission:
+  - descriptors of transmitted frames are reclaimed in the Ethernet interrupt (**HAL_ETH_TxCpltCallback**),
+    and additionally in **SendFrame** when the ring appears full
+  - **ARM_DRIVER_ERROR_BUSY** is returned only when there are not enough free descriptors for the frame,
+    for the last fragment of a frame the already sent fragments are kept, so the call can be repeated with the same parameters
+  - each frame uses one descriptor per buffer (two buffers per descriptor on devices with STM32H7 style descriptors)
 
 # CubeMX Configuration
 
@@ -275,6 +377,62 @@ static  const ARM_DRIVER_VERSION driver_version = { ARM_DRIVER_VERSION_MAJOR_MIN
 #define DRIVER_CONFIG_VALID             1
 #endif
 
+// Ethernet MAC with STM32H7 style registers and descriptors (for example STM32H5, STM32H7)
+#ifndef ETH_DMATXDESC_OWN
+#define ETH_MAC_VARIANT_QOS             1
+#endif
+
+// Number of receive DMA buffers (descriptors plus buffers that can be on loan)
+#ifndef ETH_MAC_RX_BUF_CNT
+#define ETH_MAC_RX_BUF_CNT              ETH_RX_DESC_CNT
+#endif
+#if    (ETH_MAC_RX_BUF_CNT < ETH_RX_DESC_CNT) || (ETH_MAC_RX_BUF_CNT > 32)
+#error  Ethernet MAC driver requires ETH_MAC_RX_BUF_CNT in range from ETH_RX_DESC_CNT to 32!
+#endif
+
+// Maximum number of buffers in a transmit frame
+#define ETH_MAC_TX_FRAG_MAX             ETH_TX_DESC_CNT
+
+// Number of buffers held by a transmit descriptor
+#ifdef  ETH_MAC_VARIANT_QOS
+#define ETH_MAC_TX_DESC_BUF_NUM         2U
+#else
+#define ETH_MAC_TX_DESC_BUF_NUM         1U
+#endif
+
+// PTP timestamp registers and bits
+#ifdef  ETH_MAC_VARIANT_QOS
+#define ETH_MAC_PTP_TSCR                MACTSCR
+#define ETH_MAC_PTP_TSCR_ADDEND_UPDATE  ETH_MACTSCR_TSADDREG
+#define ETH_MAC_PTP_TSAR                MACTSAR
+#define ETH_MAC_PTP_SSIR                MACSSIR
+#define ETH_MAC_PTP_SSIR_SSINC_Pos      16U
+#define ETH_MAC_PTP_TSHR                MACSTSR
+#else
+#define ETH_MAC_PTP_TSCR                PTPTSCR
+#define ETH_MAC_PTP_TSCR_ADDEND_UPDATE  ETH_PTPTSCR_TSARU
+#define ETH_MAC_PTP_TSAR                PTPTSAR
+#define ETH_MAC_PTP_SSIR                PTPSSIR
+#define ETH_MAC_PTP_SSIR_SSINC_Pos      0U
+#define ETH_MAC_PTP_TSHR                PTPTSHR
+#endif
+
+// Timeout for PTP timestamp addend update (in ms)
+#define ETH_MAC_PTP_TIMEOUT             10U
+
+// Number of additional MAC address registers used for perfect address filtering (MACA1 .. MACA3)
+#define ETH_MAC_PERFECT_ADDR_NUM        3U
+
+// Word of the hash table passed to HAL_ETH_SetHashTable that holds the specified hash table index
+#ifdef  ETH_MAC_VARIANT_QOS
+#define ETH_MAC_HASH_WORD(idx)          ((idx) >> 5)            // MACHT0R, MACHT1R
+#else
+#define ETH_MAC_HASH_WORD(idx)          (((idx) >> 5) ^ 1U)     // MACHTHR, MACHTLR
+#endif
+
+// Maximum number of transmit buffers in flight
+#define ETH_MAC_TX_REL_CNT              (ETH_MAC_TX_DESC_BUF_NUM * ETH_TX_DESC_CNT)
+
 // *****************************************************************************
 
 #ifdef  DRIVER_CONFIG_VALID             // Driver code is available only if configuration is valid
@@ -300,11 +458,33 @@ typedef struct {
   ARM_ETH_MAC_SignalEvent_t     cb_event;               // Event callback
   DriverStatus_t                drv_status;             // Driver status
   uint8_t                       alloc_idx;              // Buffer allocation index
-  uint16_t                      reserved;               // Reserved (for padding)
-  ETH_BufferTypeDef             tx_buf;                 // Transmit buffer pointers
+  uint8_t                       tx_desc_idx;            // Index of first transmit descriptor of frame being assembled
+  uint8_t                       tx_frag_num;            // Number of buffers of frame being assembled
+  uint32_t                      rx_buf_held;            // Receive buffers held by the driver or loaned (bit mask)
+  uint32_t                      rx_irq_frames;          // Number of received frames per receive interrupt (coalescing)
+  uint32_t                      rx_build_cnt;           // Number of built receive descriptors (free running)
+  uint32_t                      rx_wdt;                 // Receive interrupt watchdog value (RWT, 0 = disabled)
+  uint32_t                      rx_wdt_keep;            // Number of descriptors to build before the watchdog is disabled
+  uint32_t                      ptp_addend;             // Nominal PTP timestamp addend
+  ARM_ETH_MAC_TIME              rx_time;                // Timestamp of last received frame
+  ARM_ETH_MAC_TIME              tx_time;                // Timestamp of last transmitted frame with timestamp request
+  volatile uint8_t              tx_time_valid;          // Transmit timestamp valid flag
+  uint32_t                      tx_len;                 // Length of frame being assembled
+  uint32_t                      tx_copy_len;            // Number of bytes copied to transmit DMA buffer of frame being assembled
+  ETH_MAC_STM32_TxRelease_t     cb_tx_release;          // Transmit fragment release callback
+  volatile uint32_t             tx_desc_used;           // Number of transmit descriptors in flight (not yet released)
+  volatile uint32_t             tx_rel_head;            // Index of next fragment queued for release (wraps at ETH_MAC_TX_REL_CNT)
+  volatile uint32_t             tx_rel_tail;            // Index of next fragment to release (wraps at ETH_MAC_TX_REL_CNT)
+  volatile uint32_t             tx_rel_num;             // Number of fragments waiting for release
+  const uint8_t                *tx_rel_frag[ETH_MAC_TX_REL_CNT];   // Fragments sent without copying, waiting for release
+  uint8_t                       tx_frame_frag[ETH_TX_DESC_CNT];    // Number of fragments to release per frame (indexed by first descriptor)
+  uint8_t                       tx_frame_desc[ETH_TX_DESC_CNT];    // Number of descriptors used per frame (indexed by first descriptor)
+  ETH_BufferTypeDef             tx_buf[ETH_MAC_TX_FRAG_MAX];       // Transmit buffer chain of frame being assembled
   ETH_BufferTypeDef             rx_buf;                 // Receive buffer pointers
   ETH_MACConfigTypeDef          mac_config;             // ETH MAC configuration structure
   ETH_MACFilterConfigTypeDef    mac_filter;             // ETH MAC filter structure
+  uint32_t                      addr_reg[2U * ETH_MAC_PERFECT_ADDR_NUM];   // Perfect filter address register values (MACA1HR, MACA1LR ..)
+  uint32_t                      hash_table[2];          // Multicast hash table (as passed to HAL_ETH_SetHashTable)
 } RW_Info_t;
 
 // Compile-time Information (RO)
@@ -316,7 +496,7 @@ typedef struct {
 } RO_Info_t;
 
 // Ethernet communication data buffers that need to be positioned in non-cacheable and non-shareable normal memory
-static uint8_t                  eth_mac0_rx_buf[ETH_RX_DESC_CNT][ETH_MAX_PACKET_SIZE] __attribute__((section(".driver.eth_mac0_rx_buf")));
+static uint8_t                  eth_mac0_rx_buf[ETH_MAC_RX_BUF_CNT][ETH_MAX_PACKET_SIZE] __attribute__((section(".driver.eth_mac0_rx_buf")));
 static uint8_t                  eth_mac0_tx_buf[ETH_TX_DESC_CNT][ETH_MAX_PACKET_SIZE] __attribute__((section(".driver.eth_mac0_tx_buf")));
 
 // Information definitions
@@ -347,6 +527,396 @@ static int32_t                  ETH_MAC_ControlTimer     (uint32_t control, ARM_
 static int32_t                  ETH_MAC_PHY_Read         (uint8_t phy_addr, uint8_t reg_addr, uint16_t *data);
 static int32_t                  ETH_MAC_PHY_Write        (uint8_t phy_addr, uint8_t reg_addr, uint16_t data);
 
+// Auxiliary functions
+
+/**
+  \fn          uint32_t ETH_MAC_RxBufferIndex (const uint8_t *buf)
+  \brief       Get index of receive DMA buffer.
+  \param[in]   buf   Pointer to receive DMA buffer
+  \return      index of receive DMA buffer (ETH_MAC_RX_BUF_CNT = not a receive DMA buffer)
+*/
+static uint32_t ETH_MAC_RxBufferIndex (const uint8_t *buf) {
+  uint32_t idx;
+
+  for (idx = 0U; idx < ETH_MAC_RX_BUF_CNT; idx++) {
+    if (buf == eth_mac0_rx_buf[idx]) {
+      break;
+    }
+  }
+
+  return idx;
+}
+
+/**
+  \fn          bool ETH_MAC_RxBufferAttached (const uint8_t *buf)
+  \brief       Check if receive DMA buffer is attached to a receive DMA descriptor.
+  \param[in]   buf   Pointer to receive DMA buffer
+  \return      - true:  buffer is attached to a descriptor
+                - false: buffer is not attached to any descriptor
+*/
+static bool ETH_MAC_RxBufferAttached (const uint8_t *buf) {
+  const ETH_DMADescTypeDef *rx_desc;
+        uint32_t            desc_idx;
+
+  for (desc_idx = 0U; desc_idx < ETH_RX_DESC_CNT; desc_idx++) {
+    rx_desc = (const ETH_DMADescTypeDef *)eth_mac0_ro_info.ptr_heth->RxDescList.RxDesc[desc_idx];
+    if ((rx_desc != NULL) && (rx_desc->BackupAddr0 == (uint32_t)buf)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+  \fn          void ETH_MAC_RxBufferRelease (const uint8_t *buf)
+  \brief       Return receive DMA buffer held by the driver or loaned for reuse by the receive DMA.
+  \param[in]   buf   Pointer to receive DMA buffer
+*/
+static void ETH_MAC_RxBufferRelease (const uint8_t *buf) {
+  uint32_t idx;
+
+  idx = ETH_MAC_RxBufferIndex(buf);
+  if (idx < ETH_MAC_RX_BUF_CNT) {
+    eth_mac0_rw_info.rx_buf_held &= ~(1UL << idx);
+  }
+}
+
+/**
+  \fn          uint32_t ETH_MAC_HashIndex (const uint8_t *addr)
+  \brief       Get multicast hash table index of MAC address.
+  \param[in]   addr  Pointer to MAC address
+  \return      hash table index (0 .. 63)
+*/
+static uint32_t ETH_MAC_HashIndex (const uint8_t *addr) {
+  uint32_t crc, idx, i, bit;
+
+  // Ethernet CRC-32 of the address
+  crc = 0xFFFFFFFFU;
+  for (i = 0U; i < 6U; i++) {
+    crc ^= addr[i];
+    for (bit = 0U; bit < 8U; bit++) {
+      crc = (crc >> 1) ^ (((crc & 1U) != 0U) ? 0xEDB88320U : 0U);
+    }
+  }
+  crc = ~crc;
+
+  // Index is formed by the upper 6 bits of the bit-reversed CRC
+  idx = 0U;
+  for (bit = 0U; bit < 6U; bit++) {
+    idx = (idx << 1) | ((crc >> bit) & 1U);
+  }
+
+  return idx;
+}
+
+/**
+  \fn          void ETH_MAC_TxFragRelease (uint32_t num)
+  \brief       Release fragments sent without copying.
+  \param[in]   num   Number of fragments to release
+*/
+static void ETH_MAC_TxFragRelease (uint32_t num) {
+  const uint8_t *frag;
+
+  while ((num != 0U) && (eth_mac0_rw_info.tx_rel_num != 0U)) {
+    frag = eth_mac0_rw_info.tx_rel_frag[eth_mac0_rw_info.tx_rel_tail];
+    if (++eth_mac0_rw_info.tx_rel_tail == ETH_MAC_TX_REL_CNT) {
+      eth_mac0_rw_info.tx_rel_tail = 0U;
+    }
+    eth_mac0_rw_info.tx_rel_num--;
+    num--;
+    if (eth_mac0_rw_info.cb_tx_release != NULL) {
+      eth_mac0_rw_info.cb_tx_release(frag);
+    }
+  }
+}
+
+/**
+  \fn          int32_t ETH_MAC_AddrFilterApply (void)
+  \brief       Write configured multicast address filter to the peripheral.
+  \return      \ref execution_status
+*/
+static int32_t ETH_MAC_AddrFilterApply (void) {
+  volatile uint32_t *addr_reg;
+  uint32_t           i;
+
+  // Additional MAC address registers (high and low register pairs, high register holds the enable bit)
+  addr_reg = &eth_mac0_ro_info.ptr_heth->Instance->MACA1HR;
+  for (i = 0U; i < (2U * ETH_MAC_PERFECT_ADDR_NUM); i++) {
+    addr_reg[i] = eth_mac0_rw_info.addr_reg[i];
+  }
+
+  if (HAL_ETH_SetHashTable(eth_mac0_ro_info.ptr_heth, eth_mac0_rw_info.hash_table) != HAL_OK) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          void ETH_MAC_TxReset (void)
+  \brief       Reset transmit state after transmit descriptors were re-initialized.
+*/
+static void ETH_MAC_TxReset (void) {
+
+  // Release fragments that were not transmitted
+  ETH_MAC_TxFragRelease(eth_mac0_rw_info.tx_rel_num);
+
+  eth_mac0_rw_info.tx_frag_num  = 0U;
+  eth_mac0_rw_info.tx_desc_used = 0U;
+}
+
+/**
+  \fn          bool ETH_MAC_TxDescAvailable (uint32_t num)
+  \brief       Check if transmit descriptors are available, reclaim transmitted frames if necessary.
+  \param[in]   num   Number of required transmit descriptors
+  \return      - true:  descriptors are available
+                - false: transmit descriptor ring is full
+*/
+static bool ETH_MAC_TxDescAvailable (uint32_t num) {
+  uint32_t primask;
+
+  if ((ETH_TX_DESC_CNT - eth_mac0_rw_info.tx_desc_used) >= num) {
+    return true;
+  }
+
+  // Reclaim frames that were transmitted but their interrupt was not serviced yet
+  primask = __get_PRIMASK();
+  __disable_irq();
+  (void)HAL_ETH_ReleaseTxPacket(eth_mac0_ro_info.ptr_heth);
+  __set_PRIMASK(primask);
+
+  return ((ETH_TX_DESC_CNT - eth_mac0_rw_info.tx_desc_used) >= num);
+}
+
+/**
+  \fn          HAL_StatusTypeDef ETH_MAC_RxReadData (void)
+  \brief       Read next received frame from receive DMA descriptors, together with its timestamp.
+  \return      HAL_OK if frame was received
+*/
+static HAL_StatusTypeDef ETH_MAC_RxReadData (void) {
+  void                *dummy;
+#ifdef  HAL_ETH_USE_PTP
+  ETH_TimeStampTypeDef timestamp;
+#endif
+  HAL_StatusTypeDef    status;
+
+  status = HAL_ETH_ReadData(eth_mac0_ro_info.ptr_heth, &dummy);
+
+#ifdef  HAL_ETH_USE_PTP
+  if (status == HAL_OK) {
+    eth_mac0_rw_info.rx_time.ns  = 0U;
+    eth_mac0_rw_info.rx_time.sec = 0U;
+    if (HAL_ETH_PTP_GetRxTimestamp(eth_mac0_ro_info.ptr_heth, &timestamp) == HAL_OK) {
+      // Digital rollover mode: low word contains nanoseconds
+      eth_mac0_rw_info.rx_time.ns  = timestamp.TimeStampLow;
+      eth_mac0_rw_info.rx_time.sec = timestamp.TimeStampHigh;
+    }
+  }
+#endif
+
+  return status;
+}
+
+#ifdef  HAL_ETH_USE_PTP
+/**
+  \fn          int32_t ETH_MAC_PTP_SetAddend (uint32_t addend)
+  \brief       Set PTP timestamp addend (fine correction of timer frequency).
+  \param[in]   addend  Timestamp addend value
+  \return      \ref execution_status
+*/
+static int32_t ETH_MAC_PTP_SetAddend (uint32_t addend) {
+  uint32_t tick;
+
+  // Previous addend update must be completed
+  tick = HAL_GetTick();
+  while ((eth_mac0_ro_info.ptr_heth->Instance->ETH_MAC_PTP_TSCR & ETH_MAC_PTP_TSCR_ADDEND_UPDATE) != 0U) {
+    if ((HAL_GetTick() - tick) > ETH_MAC_PTP_TIMEOUT) {
+      return ARM_DRIVER_ERROR_TIMEOUT;
+    }
+  }
+
+  WRITE_REG(eth_mac0_ro_info.ptr_heth->Instance->ETH_MAC_PTP_TSAR, addend);
+  SET_BIT  (eth_mac0_ro_info.ptr_heth->Instance->ETH_MAC_PTP_TSCR, ETH_MAC_PTP_TSCR_ADDEND_UPDATE);
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t ETH_MAC_PTP_Init (void)
+  \brief       Configure PTP timestamp unit.
+  \return      \ref execution_status
+*/
+static int32_t ETH_MAC_PTP_Init (void) {
+  ETH_PTP_ConfigTypeDef ptp_config;
+  uint32_t              hclk, ssinc;
+
+  // Sub-second increment (in ns) of two AHB clock periods, so the nominal addend
+  // is about 2^31 and leaves range for fine correction in both directions
+  hclk  = HAL_RCC_GetHCLKFreq();
+  ssinc = (2000000000U + hclk - 1U) / hclk;
+  eth_mac0_rw_info.ptp_addend = (uint32_t)((1000000000ULL << 32) / ((uint64_t)ssinc * hclk));
+
+  memset(&ptp_config, 0, sizeof(ETH_PTP_ConfigTypeDef));
+  ptp_config.Timestamp             = ENABLE;
+  ptp_config.TimestampUpdateMode   = ENABLE;                    // Fine update
+  ptp_config.TimestampAddendUpdate = ENABLE;
+  ptp_config.TimestampAll          = ENABLE;                    // Timestamp all received frames
+  ptp_config.TimestampRolloverMode = ENABLE;                    // Digital rollover (sub-seconds in ns)
+  ptp_config.TimestampV2           = ENABLE;
+  ptp_config.TimestampEthernet     = ENABLE;
+  ptp_config.TimestampIPv6         = ENABLE;
+  ptp_config.TimestampIPv4         = ENABLE;
+  ptp_config.TimestampAddend       = eth_mac0_rw_info.ptp_addend;
+  ptp_config.TimestampSubsecondInc = ssinc;
+
+  if (HAL_ETH_PTP_SetConfig(eth_mac0_ro_info.ptr_heth, &ptp_config) != HAL_OK) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  // Sub-second increment field position depends on the MAC variant
+  WRITE_REG(eth_mac0_ro_info.ptr_heth->Instance->ETH_MAC_PTP_SSIR, ssinc << ETH_MAC_PTP_SSIR_SSINC_Pos);
+
+  return ARM_DRIVER_OK;
+}
+#endif
+
+/**
+  \fn          int32_t ETH_MAC_RxFrameLoan (ETH_MAC_STM32_RX_FRAME *ptr_frame, uint32_t max_num, uint32_t *num)
+  \brief       Loan received frames in receive DMA buffers.
+  \param[out]  ptr_frame  Pointer to array of received frame information
+  \param[in]   max_num    Maximum number of frames to loan
+  \param[out]  num        Pointer where number of loaned frames is written to (NULL = not used)
+  \return      \ref execution_status
+*/
+static int32_t ETH_MAC_RxFrameLoan (ETH_MAC_STM32_RX_FRAME *ptr_frame, uint32_t max_num, uint32_t *num) {
+  uint32_t cnt;
+
+  if ((ptr_frame == NULL) || (max_num == 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  for (cnt = 0U; cnt < max_num; cnt++) {
+    ptr_frame[cnt].data     = NULL;
+    ptr_frame[cnt].len      = 0U;
+    ptr_frame[cnt].time.ns  = 0U;
+    ptr_frame[cnt].time.sec = 0U;
+
+    if (ETH_MAC_GetRxFrameSize() == 0U) {
+      // No more frames available
+      break;
+    }
+
+    // Hand over the receive DMA buffer, it stays held until it is released
+    ptr_frame[cnt].data = eth_mac0_rw_info.rx_buf.buffer;
+    ptr_frame[cnt].len  = eth_mac0_rw_info.rx_buf.len;
+    ptr_frame[cnt].time = eth_mac0_rw_info.rx_time;
+    eth_mac0_rw_info.rx_buf.buffer = NULL;
+  }
+
+  if (num != NULL) {
+    *num = cnt;
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t ETH_MAC_RxFrameRelease (ETH_MAC_STM32_RX_FRAME *ptr_frame, uint32_t num)
+  \brief       Release loaned receive DMA buffers.
+  \param[in]   ptr_frame  Pointer to array of received frame information
+  \param[in]   num        Number of frames to release
+  \return      \ref execution_status
+*/
+static int32_t ETH_MAC_RxFrameRelease (ETH_MAC_STM32_RX_FRAME *ptr_frame, uint32_t num) {
+  uint32_t cnt;
+
+  if (ptr_frame == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  for (cnt = 0U; cnt < num; cnt++) {
+    if (ETH_MAC_RxBufferIndex(ptr_frame[cnt].data) >= ETH_MAC_RX_BUF_CNT) {
+      return ARM_DRIVER_ERROR_PARAMETER;
+    }
+  }
+
+  for (cnt = 0U; cnt < num; cnt++) {
+    ETH_MAC_RxBufferRelease(ptr_frame[cnt].data);
+    ptr_frame[cnt].data = NULL;
+    ptr_frame[cnt].len  = 0U;
+  }
+
+  if ((eth_mac0_rw_info.rx_buf.buffer == NULL) && (eth_mac0_ro_info.ptr_heth->RxDescList.RxBuildDescCnt != 0U)) {
+    // Attach released buffers to receive DMA descriptors that were left without buffer,
+    // a frame read at the same time is kept for GetRxFrameSize
+    (void)ETH_MAC_RxReadData();
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          void ETH_MAC_RxWatchdog (uint32_t rwt)
+  \brief       Set receive interrupt watchdog.
+  \param[in]   rwt   Watchdog value in units of 256 AHB clock cycles (0 = disabled)
+*/
+static void ETH_MAC_RxWatchdog (uint32_t rwt) {
+
+  eth_mac0_rw_info.rx_wdt = rwt;
+
+#ifdef  ETH_MAC_VARIANT_QOS
+  WRITE_REG(eth_mac0_ro_info.ptr_heth->Instance->DMACRIWTR, rwt);
+#else
+  WRITE_REG(eth_mac0_ro_info.ptr_heth->Instance->DMARSWTR, rwt);
+#endif
+}
+
+/**
+  \fn          int32_t ETH_MAC_RxCoalesce (uint32_t arg)
+  \brief       Configure receive interrupt coalescing.
+  \param[in]   arg   Frame count and timeout (see ETH_MAC_STM32_RX_COALESCE_...)
+  \return      \ref execution_status
+*/
+static int32_t ETH_MAC_RxCoalesce (uint32_t arg) {
+  uint32_t frames, time_us, rwt;
+
+  frames  = (arg & ETH_MAC_STM32_RX_COALESCE_FRAMES_Msk) >> ETH_MAC_STM32_RX_COALESCE_FRAMES_Pos;
+  time_us = (arg & ETH_MAC_STM32_RX_COALESCE_TIME_Msk)   >> ETH_MAC_STM32_RX_COALESCE_TIME_Pos;
+
+  if (frames == 0U) {
+    frames = 1U;
+  }
+  if ((frames > ETH_RX_DESC_CNT) || ((frames > 1U) && (time_us == 0U))) {
+    // Frames without interrupt must be signaled by the watchdog before the ring is full
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  // Receive interrupt watchdog counts in units of 256 AHB clock cycles
+  rwt = (((HAL_RCC_GetHCLKFreq() / 1000000U) * time_us) + 255U) / 256U;
+  if (rwt > 0xFFU) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((rwt == 0U) && ((eth_mac0_rw_info.rx_irq_frames > 1U) || (eth_mac0_rw_info.rx_wdt_keep != 0U))) {
+    // Descriptors built without interrupt on completion can still be in the ring, keep the watchdog
+    // until all descriptors were built again (see HAL_ETH_RxAllocateCallback)
+    if (eth_mac0_rw_info.rx_irq_frames > 1U) {
+      eth_mac0_rw_info.rx_wdt_keep = ETH_RX_DESC_CNT;
+    }
+  } else {
+    eth_mac0_rw_info.rx_wdt_keep = 0U;
+    ETH_MAC_RxWatchdog(rwt);
+  }
+
+  eth_mac0_rw_info.rx_irq_frames = frames;
+  if ((frames == 1U) && (eth_mac0_ro_info.ptr_heth->gState == HAL_ETH_STATE_STARTED)) {
+    // Descriptors built from now on interrupt on every frame
+    eth_mac0_ro_info.ptr_heth->RxDescList.ItMode = 1U;
+  }
+
+  return ARM_DRIVER_OK;
+}
+
 // Driver functions ************************************************************
 
 /**
@@ -391,6 +961,10 @@ static ARM_ETH_MAC_CAPABILITIES ETH_MAC_GetCapabilities (void) {
   driver_capabilities.event_tx_frame = 1U;
   driver_capabilities.event_wakeup   = 1U;
 
+#ifdef  HAL_ETH_USE_PTP
+  driver_capabilities.precision_timer = 1U;
+#endif
+
   return driver_capabilities;
 }
 
@@ -451,7 +1025,27 @@ static int32_t ETH_MAC_PowerControl (ARM_POWER_STATE state) {
         return ARM_DRIVER_ERROR;
       }
 
-      eth_mac0_rw_info.tx_buf.len = 0;
+      ETH_MAC_TxReset();
+
+      eth_mac0_rw_info.rx_buf.buffer = NULL;
+      eth_mac0_rw_info.rx_buf_held   = 0U;
+
+      // Peripheral reset disabled the receive interrupt watchdog, interrupt on every frame
+      eth_mac0_rw_info.rx_irq_frames = 1U;
+      eth_mac0_rw_info.rx_wdt        = 0U;
+      eth_mac0_rw_info.rx_wdt_keep   = 0U;
+
+      // Peripheral reset disabled the multicast address filter
+      memset(eth_mac0_rw_info.addr_reg,   0, sizeof(eth_mac0_rw_info.addr_reg));
+      memset(eth_mac0_rw_info.hash_table, 0, sizeof(eth_mac0_rw_info.hash_table));
+
+#ifdef  HAL_ETH_USE_PTP
+      // Configure PTP timestamp unit
+      eth_mac0_rw_info.tx_time_valid = 0U;
+      if (ETH_MAC_PTP_Init() != ARM_DRIVER_OK) {
+        return ARM_DRIVER_ERROR;
+      }
+#endif
 
       // Set driver status to powered
       eth_mac0_rw_info.drv_status.powered = 1U;
@@ -462,6 +1056,8 @@ static int32_t ETH_MAC_PowerControl (ARM_POWER_STATE state) {
       // De-initialize pins, clocks, interrupts and peripheral
       (void)HAL_ETH_DeInit(eth_mac0_ro_info.ptr_heth);
 
+      ETH_MAC_TxReset();
+
       // Set driver status to not powered
       eth_mac0_rw_info.drv_status.powered = 0U;
       break;
@@ -513,6 +1109,12 @@ static int32_t ETH_MAC_SetMacAddress (const ARM_ETH_MAC_ADDR *ptr_addr) {
     return ARM_DRIVER_ERROR;
   }
 
+  // Save MAC configuration and filter, which are reset by the reinitialization
+  if ((HAL_ETH_GetMACConfig      (eth_mac0_ro_info.ptr_heth, &eth_mac0_rw_info.mac_config) != HAL_OK) ||
+      (HAL_ETH_GetMACFilterConfig(eth_mac0_ro_info.ptr_heth, &eth_mac0_rw_info.mac_filter) != HAL_OK)) {
+    return ARM_DRIVER_ERROR;
+  }
+
   memcpy(eth_mac0_ro_info.ptr_heth->Init.MACAddr, ptr_addr, 6);
 
   // Reinitialize ETH to change the MAC address
@@ -520,6 +1122,27 @@ static int32_t ETH_MAC_SetMacAddress (const ARM_ETH_MAC_ADDR *ptr_addr) {
     return ARM_DRIVER_ERROR;
   }
 
+  // Transmit descriptors were re-initialized
+  ETH_MAC_TxReset();
+
+  // Restore receive interrupt watchdog cleared by the peripheral reset
+  ETH_MAC_RxWatchdog(eth_mac0_rw_info.rx_wdt);
+
+#ifdef  HAL_ETH_USE_PTP
+  // Reconfigure PTP timestamp unit cleared by the peripheral reset
+  eth_mac0_rw_info.tx_time_valid = 0U;
+  if (ETH_MAC_PTP_Init() != ARM_DRIVER_OK) {
+    return ARM_DRIVER_ERROR;
+  }
+#endif
+
+  // Restore MAC configuration, filter and multicast address filter cleared by the peripheral reset
+  if ((HAL_ETH_SetMACConfig      (eth_mac0_ro_info.ptr_heth, &eth_mac0_rw_info.mac_config) != HAL_OK) ||
+      (HAL_ETH_SetMACFilterConfig(eth_mac0_ro_info.ptr_heth, &eth_mac0_rw_info.mac_filter) != HAL_OK) ||
+      (ETH_MAC_AddrFilterApply() != ARM_DRIVER_OK)) {
+    return ARM_DRIVER_ERROR;
+  }
+
   return ARM_DRIVER_OK;
 }
 
@@ -532,11 +1155,63 @@ static int32_t ETH_MAC_SetMacAddress (const ARM_ETH_MAC_ADDR *ptr_addr) {
   \return      \ref execution_status
 */
 static int32_t ETH_MAC_SetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_addr) {
-  (void)ptr_addr;
-  (void)num_addr;
+  uint32_t      *addr_reg;
+  const uint8_t *addr;
+  uint32_t       i, idx;
 
-  // Not supported by HAL
-  return ARM_DRIVER_ERROR_UNSUPPORTED;
+  if ((ptr_addr == NULL) && (num_addr != 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if (eth_mac0_rw_info.drv_status.powered == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (HAL_ETH_GetMACFilterConfig(eth_mac0_ro_info.ptr_heth, &eth_mac0_rw_info.mac_filter) != HAL_OK) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  // First addresses are perfect filtered with additional MAC address registers (high and low register pairs),
+  // not used registers are disabled
+  addr_reg = eth_mac0_rw_info.addr_reg;
+  for (i = 0U; i < ETH_MAC_PERFECT_ADDR_NUM; i++) {
+    if (i < num_addr) {
+      addr = ptr_addr[i].b;
+      addr_reg[2U * i]        =  ((uint32_t)addr[5] <<  8) |  (uint32_t)addr[4] | ETH_MACA1HR_AE;
+      addr_reg[(2U * i) + 1U] =  ((uint32_t)addr[3] << 24) | ((uint32_t)addr[2] << 16) |
+                                 ((uint32_t)addr[1] <<  8) |  (uint32_t)addr[0];
+    } else {
+      addr_reg[2U * i]        =  0U;
+      addr_reg[(2U * i) + 1U] =  0U;
+    }
+  }
+
+  // Remaining addresses are filtered with the 64-bit hash table
+  eth_mac0_rw_info.hash_table[0] = 0U;
+  eth_mac0_rw_info.hash_table[1] = 0U;
+  for (i = ETH_MAC_PERFECT_ADDR_NUM; i < num_addr; i++) {
+    idx = ETH_MAC_HashIndex(ptr_addr[i].b);
+    eth_mac0_rw_info.hash_table[ETH_MAC_HASH_WORD(idx)] |= (1UL << (idx & 0x1FU));
+  }
+
+  if (ETH_MAC_AddrFilterApply() != ARM_DRIVER_OK) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (num_addr > ETH_MAC_PERFECT_ADDR_NUM) {
+    // Pass multicast frames that match either the hash table or a perfect filter address
+    eth_mac0_rw_info.mac_filter.HashMulticast       = ENABLE;
+    eth_mac0_rw_info.mac_filter.HachOrPerfectFilter = ENABLE;
+  } else {
+    eth_mac0_rw_info.mac_filter.HashMulticast       = DISABLE;
+    eth_mac0_rw_info.mac_filter.HachOrPerfectFilter = DISABLE;
+  }
+
+  if (HAL_ETH_SetMACFilterConfig(eth_mac0_ro_info.ptr_heth, &eth_mac0_rw_info.mac_filter) != HAL_OK) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  return ARM_DRIVER_OK;
 }
 
 /**
@@ -548,8 +1223,11 @@ static int32_t ETH_MAC_SetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint3
   \return      \ref execution_status
 */
 static int32_t ETH_MAC_SendFrame (const uint8_t *frame, uint32_t len, uint32_t flags) {
-  ETH_DMADescTypeDef *tx_desc;
-  uint32_t            tx_index;
+  ETH_BufferTypeDef  *tx_buf;
+  uint8_t            *copy_buf;
+  uint32_t            tx_index, frag_num, desc_num, i;
+  uint32_t            primask;
+  HAL_StatusTypeDef   status;
 
   if ((frame == NULL) || (len == 0U)) {
     // If any parameter is invalid
@@ -560,42 +1238,123 @@ static int32_t ETH_MAC_SendFrame (const uint8_t *frame, uint32_t len, uint32_t f
     return ARM_DRIVER_ERROR;
   }
 
-  if (eth_mac0_rw_info.tx_buf.len == 0) {
-    // Start of a new transmit frame
+  if (eth_mac0_rw_info.tx_frag_num == 0U) {
+    // Start of a new transmit frame, its first descriptor (and transmit DMA buffer) must be released
+    if (!ETH_MAC_TxDescAvailable(1U)) {
+      // If transmit descriptor ring is full
+      return ARM_DRIVER_ERROR_BUSY;
+    }
+
     tx_index = eth_mac0_ro_info.ptr_heth->TxDescList.CurTxDesc;
-    tx_desc  = (ETH_DMADescTypeDef *)eth_mac0_ro_info.ptr_heth->TxDescList.TxDesc[tx_index];
 
-#ifdef ETH_DMATXDESC_OWN
-    if ((*((volatile uint32_t *)tx_desc) & ETH_DMATXDESC_OWN) != 0U) {
-#else
-    if ((tx_desc->DESC3 & ETH_DMATXNDESCWBF_OWN) != 0U) {
-#endif
-      // If Transmitter is busy
+    eth_mac0_rw_info.tx_desc_idx             = (uint8_t)tx_index;
+    eth_mac0_rw_info.tx_len                  = 0U;
+    eth_mac0_rw_info.tx_copy_len             = 0U;
+    eth_mac0_rw_info.tx_frame_frag[tx_index] = 0U;
+  }
+
+  tx_index = eth_mac0_rw_info.tx_desc_idx;
+  frag_num = eth_mac0_rw_info.tx_frag_num;
+  tx_buf   = eth_mac0_rw_info.tx_buf;
+
+  if ((flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT) == 0U) {
+    // Last fragment, check that the whole frame fits into the free transmit descriptors
+    desc_num = (frag_num + ETH_MAC_TX_DESC_BUF_NUM) / ETH_MAC_TX_DESC_BUF_NUM;
+    if (!ETH_MAC_TxDescAvailable(desc_num)) {
+      // Frame is kept, sending of the last fragment can be repeated
       return ARM_DRIVER_ERROR_BUSY;
     }
+  }
 
-    eth_mac0_rw_info.tx_buf.buffer = eth_mac0_tx_buf[tx_index];
-    eth_mac0_rw_info.tx_buf.next   = NULL;
+  if ((flags & ETH_MAC_STM32_TX_FRAME_NO_COPY) != 0U) {
+    // Link fragment from caller's buffer
+    if (frag_num >= ETH_MAC_TX_FRAG_MAX) {
+      eth_mac0_rw_info.tx_frag_num = 0U;
+      return ARM_DRIVER_ERROR;
+    }
+    tx_buf[frag_num].buffer = (uint8_t *)(uint32_t)frame;
+    tx_buf[frag_num].len    = len;
+    frag_num++;
+    eth_mac0_rw_info.tx_frame_frag[tx_index]++;
+  } else {
+    // Copy data fragment to ETH-DMA buffer
+    if ((eth_mac0_rw_info.tx_copy_len + len) > ETH_MAX_PACKET_SIZE) {
+      eth_mac0_rw_info.tx_frag_num = 0U;
+      return ARM_DRIVER_ERROR;
+    }
+    copy_buf = &eth_mac0_tx_buf[tx_index][eth_mac0_rw_info.tx_copy_len];
+    memcpy(copy_buf, frame, len);
+    eth_mac0_rw_info.tx_copy_len += len;
+
+    if ((frag_num != 0U) && ((tx_buf[frag_num - 1U].buffer + tx_buf[frag_num - 1U].len) == copy_buf)) {
+      // Merge with previous copied fragment
+      tx_buf[frag_num - 1U].len += len;
+    } else {
+      if (frag_num >= ETH_MAC_TX_FRAG_MAX) {
+        eth_mac0_rw_info.tx_frag_num = 0U;
+        return ARM_DRIVER_ERROR;
+      }
+      tx_buf[frag_num].buffer = copy_buf;
+      tx_buf[frag_num].len    = len;
+      frag_num++;
+    }
   }
 
-  // Copy data fragments to ETH-DMA buffer
-  memcpy(eth_mac0_rw_info.tx_buf.buffer + eth_mac0_rw_info.tx_buf.len, frame, len);
-  eth_mac0_rw_info.tx_buf.len += len;
+  eth_mac0_rw_info.tx_frag_num = (uint8_t)frag_num;
+  eth_mac0_rw_info.tx_len     += len;
 
   if ((flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT) != 0U) {
     // More data to come, remember current write position
     return ARM_DRIVER_OK;
   }
 
-  // Last fragment, send the packet now
-  eth_mac0_ro_info.ptr_TxConfig->TxBuffer = &eth_mac0_rw_info.tx_buf;
-  eth_mac0_ro_info.ptr_TxConfig->Length   =  eth_mac0_rw_info.tx_buf.len;
+  // Last fragment, link the buffer chain and send the packet now
+  for (i = 0U; i < frag_num; i++) {
+    tx_buf[i].next = ((i + 1U) < frag_num) ? &tx_buf[i + 1U] : NULL;
+  }
+  eth_mac0_ro_info.ptr_TxConfig->TxBuffer = tx_buf;
+  eth_mac0_ro_info.ptr_TxConfig->Length   = eth_mac0_rw_info.tx_len;
+  eth_mac0_ro_info.ptr_TxConfig->pData    = &eth_mac0_rw_info.tx_frame_frag[tx_index];
+
+  desc_num = (frag_num + ETH_MAC_TX_DESC_BUF_NUM - 1U) / ETH_MAC_TX_DESC_BUF_NUM;
+  eth_mac0_rw_info.tx_frame_desc[tx_index] = (uint8_t)desc_num;
+
+  // Transmitted frames are released from the interrupt, so queue fragments for release
+  // together with starting the transmission
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+#ifdef  HAL_ETH_USE_PTP
+  if ((flags & ARM_ETH_MAC_TX_FRAME_TIMESTAMP) != 0U) {
+    // Capture transmit timestamp of this frame, previous timestamp is no longer valid
+    eth_mac0_rw_info.tx_time_valid = 0U;
+    (void)HAL_ETH_PTP_InsertTxTimestamp(eth_mac0_ro_info.ptr_heth);
+  }
+#endif
 
-  if (HAL_ETH_Transmit_IT(eth_mac0_ro_info.ptr_heth, eth_mac0_ro_info.ptr_TxConfig) != HAL_OK) {
-    return ARM_DRIVER_ERROR;
+  status = HAL_ETH_Transmit_IT(eth_mac0_ro_info.ptr_heth, eth_mac0_ro_info.ptr_TxConfig);
+  if (status == HAL_OK) {
+    eth_mac0_rw_info.tx_desc_used += desc_num;
+    for (i = 0U; i < frag_num; i++) {
+      if ((tx_buf[i].buffer <  eth_mac0_tx_buf[tx_index]) ||
+          (tx_buf[i].buffer >= eth_mac0_tx_buf[tx_index] + ETH_MAX_PACKET_SIZE)) {
+        // Fragment was sent without copying
+        eth_mac0_rw_info.tx_rel_frag[eth_mac0_rw_info.tx_rel_head] = tx_buf[i].buffer;
+        if (++eth_mac0_rw_info.tx_rel_head == ETH_MAC_TX_REL_CNT) {
+          eth_mac0_rw_info.tx_rel_head = 0U;
+        }
+        eth_mac0_rw_info.tx_rel_num++;
+      }
+    }
   }
 
-  eth_mac0_rw_info.tx_buf.len = 0;
+  __set_PRIMASK(primask);
+
+  eth_mac0_rw_info.tx_frag_num = 0U;
+
+  if (status != HAL_OK) {
+    return ARM_DRIVER_ERROR;
+  }
 
   return ARM_DRIVER_OK;
 }
@@ -623,10 +1382,14 @@ static int32_t ETH_MAC_ReadFrame (uint8_t *frame, uint32_t len) {
 
   ret = 0;
 
-  if ((frame != NULL) && (eth_mac0_rw_info.rx_buf.buffer != NULL)) {
-    memcpy(frame, eth_mac0_rw_info.rx_buf.buffer, len);
+  if (eth_mac0_rw_info.rx_buf.buffer != NULL) {
+    if (frame != NULL) {
+      memcpy(frame, eth_mac0_rw_info.rx_buf.buffer, len);
+      ret = (int32_t)len;
+    }
+    // Return receive DMA buffer (also if frame is discarded)
+    ETH_MAC_RxBufferRelease(eth_mac0_rw_info.rx_buf.buffer);
     eth_mac0_rw_info.rx_buf.buffer = NULL;
-    ret = (int32_t)len;
   }
 
   return ret;
@@ -638,9 +1401,13 @@ static int32_t ETH_MAC_ReadFrame (uint8_t *frame, uint32_t len) {
   \return      number of bytes in received frame
 */
 static uint32_t ETH_MAC_GetRxFrameSize (void) {
-  void *dummy;
 
-  if (HAL_ETH_ReadData(eth_mac0_ro_info.ptr_heth, &dummy) == HAL_OK) {
+  if (eth_mac0_rw_info.rx_buf.buffer != NULL) {
+    // Frame was already received but not yet read
+    return eth_mac0_rw_info.rx_buf.len;
+  }
+
+  if (ETH_MAC_RxReadData() == HAL_OK) {
     // Length returned in a Link callback function
     return ((volatile uint32_t)eth_mac0_rw_info.rx_buf.len);
   }
@@ -656,10 +1423,30 @@ static uint32_t ETH_MAC_GetRxFrameSize (void) {
   \return      \ref execution_status
 */
 static int32_t ETH_MAC_GetRxFrameTime (ARM_ETH_MAC_TIME *time) {
+#ifdef  HAL_ETH_USE_PTP
+
+  if (time == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if (eth_mac0_rw_info.drv_status.powered == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (eth_mac0_rw_info.rx_buf.buffer == NULL) {
+    // No frame received that was not yet read
+    return ARM_DRIVER_ERROR;
+  }
+
+  *time = eth_mac0_rw_info.rx_time;
+
+  return ARM_DRIVER_OK;
+#else
   (void)time;
 
   // Not supported by HAL
   return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
 }
 
 /**
@@ -669,10 +1456,37 @@ static int32_t ETH_MAC_GetRxFrameTime (ARM_ETH_MAC_TIME *time) {
   \return      \ref execution_status
 */
 static int32_t ETH_MAC_GetTxFrameTime (ARM_ETH_MAC_TIME *time) {
+#ifdef  HAL_ETH_USE_PTP
+  uint32_t primask;
+  int32_t  status;
+
+  if (time == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if (eth_mac0_rw_info.drv_status.powered == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  // Timestamp is captured when transmitted frame is released in the interrupt
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (eth_mac0_rw_info.tx_time_valid != 0U) {
+    *time  = eth_mac0_rw_info.tx_time;
+    status = ARM_DRIVER_OK;
+  } else {
+    // No timestamped frame transmitted
+    status = ARM_DRIVER_ERROR;
+  }
+  __set_PRIMASK(primask);
+
+  return status;
+#else
   (void)time;
 
   // Not supported by HAL
   return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
 }
 
 /**
@@ -683,7 +1497,8 @@ static int32_t ETH_MAC_GetTxFrameTime (ARM_ETH_MAC_TIME *time) {
   \return      \ref execution_status
 */
 static int32_t ETH_MAC_Control (uint32_t control, uint32_t arg) {
-  HAL_StatusTypeDef g_state;
+  ETH_MAC_STM32_RX_FRAMES *ptr_frames;
+  HAL_StatusTypeDef        g_state;
 
   if (eth_mac0_rw_info.drv_status.powered == 0U) {
     return ARM_DRIVER_ERROR;
@@ -733,6 +1548,33 @@ static int32_t ETH_MAC_Control (uint32_t control, uint32_t arg) {
     case ARM_ETH_MAC_SLEEP:
       return ARM_DRIVER_ERROR_UNSUPPORTED;
 
+    case ETH_MAC_STM32_RX_FRAME_LOAN:           // Loan received frame; arg = pointer to ETH_MAC_STM32_RX_FRAME
+      return ETH_MAC_RxFrameLoan((ETH_MAC_STM32_RX_FRAME *)arg, 1U, NULL);
+
+    case ETH_MAC_STM32_RX_FRAME_RELEASE:        // Release loaned frame; arg = pointer to ETH_MAC_STM32_RX_FRAME
+      return ETH_MAC_RxFrameRelease((ETH_MAC_STM32_RX_FRAME *)arg, 1U);
+
+    case ETH_MAC_STM32_RX_COALESCE:             // Set receive interrupt coalescing; arg = frame count and timeout
+      return ETH_MAC_RxCoalesce(arg);
+
+    case ETH_MAC_STM32_RX_FRAMES_LOAN:          // Loan received frames; arg = pointer to ETH_MAC_STM32_RX_FRAMES
+      ptr_frames = (ETH_MAC_STM32_RX_FRAMES *)arg;
+      if (ptr_frames == NULL) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      return ETH_MAC_RxFrameLoan(ptr_frames->frame, ptr_frames->max_num, &ptr_frames->num);
+
+    case ETH_MAC_STM32_RX_FRAMES_RELEASE:       // Release loaned frames; arg = pointer to ETH_MAC_STM32_RX_FRAMES
+      ptr_frames = (ETH_MAC_STM32_RX_FRAMES *)arg;
+      if (ptr_frames == NULL) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      return ETH_MAC_RxFrameRelease(ptr_frames->frame, ptr_frames->num);
+
+    case ETH_MAC_STM32_SET_TX_RELEASE_CB:       // Set transmit fragment release callback; arg = pointer to function
+      eth_mac0_rw_info.cb_tx_release = (ETH_MAC_STM32_TxRelease_t)arg;
+      return ARM_DRIVER_OK;
+
     default:                                    // Unknown Control
       return ARM_DRIVER_ERROR_PARAMETER;
   }
@@ -829,11 +1671,73 @@ static int32_t ETH_MAC_Control (uint32_t control, uint32_t arg) {
   \return      \ref execution_status
 */
 static int32_t ETH_MAC_ControlTimer (uint32_t control, ARM_ETH_MAC_TIME *time) {
+#ifdef  HAL_ETH_USE_PTP
+  ETH_TimeTypeDef   ptp_time;
+  uint64_t          addend;
+  uint32_t          sec;
+  HAL_StatusTypeDef status;
+
+  if (time == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if (eth_mac0_rw_info.drv_status.powered == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  ptp_time.Seconds     = time->sec;
+  ptp_time.NanoSeconds = time->ns;
+
+  switch (control) {
+    case ARM_ETH_MAC_TIMER_GET_TIME:            // Get current time
+      // Seconds and nanoseconds are read from separate registers,
+      // read again if seconds changed in between (nanoseconds rolled over)
+      do {
+        status = HAL_ETH_PTP_GetTime(eth_mac0_ro_info.ptr_heth, &ptp_time);
+        sec    = eth_mac0_ro_info.ptr_heth->Instance->ETH_MAC_PTP_TSHR;
+      } while ((status == HAL_OK) && (sec != ptp_time.Seconds));
+      time->sec = ptp_time.Seconds;
+      time->ns  = ptp_time.NanoSeconds;
+      break;
+
+    case ARM_ETH_MAC_TIMER_SET_TIME:            // Set new time
+      status = HAL_ETH_PTP_SetTime(eth_mac0_ro_info.ptr_heth, &ptp_time);
+      break;
+
+    case ARM_ETH_MAC_TIMER_INC_TIME:            // Increment current time
+      status = HAL_ETH_PTP_AddTimeOffset(eth_mac0_ro_info.ptr_heth, HAL_ETH_PTP_POSITIVE_UPDATE, &ptp_time);
+      break;
+
+    case ARM_ETH_MAC_TIMER_DEC_TIME:            // Decrement current time
+      status = HAL_ETH_PTP_AddTimeOffset(eth_mac0_ro_info.ptr_heth, HAL_ETH_PTP_NEGATIVE_UPDATE, &ptp_time);
+      break;
+
+    case ARM_ETH_MAC_TIMER_ADJUST_CLOCK:        // Adjust clock frequency; time->ns: correction factor * 2^31
+      addend = ((uint64_t)eth_mac0_rw_info.ptp_addend * time->ns) >> 31;
+      if (addend > UINT32_MAX) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      return ETH_MAC_PTP_SetAddend((uint32_t)addend);
+
+    case ARM_ETH_MAC_TIMER_SET_ALARM:           // Set alarm time
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+
+    default:
+      return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if (status != HAL_OK) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  return ARM_DRIVER_OK;
+#else
   (void)control;
   (void)time;
 
   // Not supported by HAL
   return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
 }
 
 /**
@@ -881,12 +1785,39 @@ static int32_t ETH_MAC_PHY_Write (uint8_t phy_addr, uint8_t reg_addr, uint16_t d
   * @retval None
   */
 void HAL_ETH_RxAllocateCallback(uint8_t **buff) {
+  uint32_t cnt, idx;
+
+  // Allocate one of the RX-DMA buffers sequentially, skipping buffers that are held or still attached,
+  // if none is free the descriptor is left without buffer and is attached on a later HAL_ETH_ReadData
+  *buff = NULL;
+  for (cnt = 0U; cnt < ETH_MAC_RX_BUF_CNT; cnt++) {
+    idx = eth_mac0_rw_info.alloc_idx;
+    eth_mac0_rw_info.alloc_idx += 1U;
+    if (eth_mac0_rw_info.alloc_idx >= ETH_MAC_RX_BUF_CNT) {
+      eth_mac0_rw_info.alloc_idx = 0U;
+    }
+    if (((eth_mac0_rw_info.rx_buf_held & (1UL << idx)) == 0U) && !ETH_MAC_RxBufferAttached(eth_mac0_rx_buf[idx])) {
+      *buff = eth_mac0_rx_buf[idx];
+      break;
+    }
+  }
 
-  // Allocate one of the RX-DMA buffers sequentially
-  *buff = eth_mac0_rx_buf[eth_mac0_rw_info.alloc_idx];
-  eth_mac0_rw_info.alloc_idx += 1U;
-  if (eth_mac0_rw_info.alloc_idx >= ETH_RX_DESC_CNT) {
-    eth_mac0_rw_info.alloc_idx = 0U;
+  if ((*buff != NULL) && (eth_mac0_rw_info.rx_irq_frames > 1U)) {
+    // Receive interrupt coalescing: HAL builds the descriptor after this callback with interrupt on completion
+    // according to ItMode, so only every n-th descriptor interrupts and the watchdog signals the others
+    eth_mac0_rw_info.rx_build_cnt++;
+    if ((eth_mac0_rw_info.rx_build_cnt % eth_mac0_rw_info.rx_irq_frames) == 0U) {
+      eth_mac0_ro_info.ptr_heth->RxDescList.ItMode = 1U;
+    } else {
+      eth_mac0_ro_info.ptr_heth->RxDescList.ItMode = 0U;
+    }
+  } else if ((*buff != NULL) && (eth_mac0_rw_info.rx_wdt_keep != 0U)) {
+    // Coalescing was disabled: once all descriptors were built again with interrupt on completion,
+    // no frame relies on the watchdog anymore
+    eth_mac0_rw_info.rx_wdt_keep--;
+    if (eth_mac0_rw_info.rx_wdt_keep == 0U) {
+      ETH_MAC_RxWatchdog(0U);
+    }
   }
 }
 
@@ -899,9 +1830,22 @@ void HAL_ETH_RxAllocateCallback(uint8_t **buff) {
   * @retval None
   */
 void HAL_ETH_RxLinkCallback(void **pStart, void **pEnd, uint8_t *buff, uint16_t Length) {
+  uint32_t idx;
+
   (void)pStart;
   (void)pEnd;
 
+  if (eth_mac0_rw_info.rx_buf.buffer != NULL) {
+    // Frame spanning several buffers is not supported, only the last buffer is kept
+    ETH_MAC_RxBufferRelease(eth_mac0_rw_info.rx_buf.buffer);
+  }
+
+  // Buffer is held by the driver until the frame is read or released
+  idx = ETH_MAC_RxBufferIndex(buff);
+  if (idx < ETH_MAC_RX_BUF_CNT) {
+    eth_mac0_rw_info.rx_buf_held |= (1UL << idx);
+  }
+
   eth_mac0_rw_info.rx_buf.buffer = buff;
   eth_mac0_rw_info.rx_buf.len    = Length;
 }
@@ -913,13 +1857,51 @@ void HAL_ETH_RxLinkCallback(void **pStart, void **pEnd, uint8_t *buff, uint16_t
   * @retval None
   */
 void HAL_ETH_TxCpltCallback(ETH_HandleTypeDef *h_eth) {
-  (void)h_eth;
+
+  // Reclaim descriptors of all transmitted frames
+  (void)HAL_ETH_ReleaseTxPacket(h_eth);
 
   if (eth_mac0_rw_info.cb_event != NULL) {
     eth_mac0_rw_info.cb_event(ARM_ETH_MAC_EVENT_TX_FRAME);
   }
 }
 
+/**
+  * @brief  Tx Free callback.
+  * @param  buff: pointer to buffer to free
+  * @retval None
+  */
+void HAL_ETH_TxFreeCallback(uint32_t *buff) {
+  uint32_t idx;
+
+  // Frame is identified by its first descriptor
+  idx = (uint32_t)((const uint8_t *)buff - eth_mac0_rw_info.tx_frame_frag);
+
+  // Release fragments of transmitted frame that were sent without copying
+  ETH_MAC_TxFragRelease(eth_mac0_rw_info.tx_frame_frag[idx]);
+
+  // Descriptors of transmitted frame can be reused
+  eth_mac0_rw_info.tx_desc_used -= eth_mac0_rw_info.tx_frame_desc[idx];
+}
+
+#ifdef  HAL_ETH_USE_PTP
+/**
+  * @brief  Tx Ptp callback.
+  * @param  buff: pointer to application buffer
+  * @param  timestamp: pointer to ETH_TimeStampTypeDef structure that contains
+  *         transmission timestamp
+  * @retval None
+  */
+void HAL_ETH_TxPtpCallback(uint32_t *buff, ETH_TimeStampTypeDef *timestamp) {
+  (void)buff;
+
+  // Digital rollover mode: low word contains nanoseconds
+  eth_mac0_rw_info.tx_time.ns  = timestamp->TimeStampLow;
+  eth_mac0_rw_info.tx_time.sec = timestamp->TimeStampHigh;
+  eth_mac0_rw_info.tx_time_valid = 1U;
+}
+#endif
+
 /**
   * @brief  Rx Transfer completed callbacks.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -36,6 +36,48 @@ extern  "C"
 {
 #endif
 
+// Driver specific Control codes **********************************************
+// (values of the Control codes not used by the CMSIS-Driver Ethernet MAC API)
+
+#define ETH_MAC_STM32_RX_FRAME_LOAN     (0x80UL)        // Get received frame in receive DMA buffer without copying; arg = pointer to ETH_MAC_STM32_RX_FRAME
+#define ETH_MAC_STM32_RX_FRAME_RELEASE  (0x81UL)        // Return loaned receive DMA buffer to the driver; arg = pointer to ETH_MAC_STM32_RX_FRAME
+#define ETH_MAC_STM32_SET_TX_RELEASE_CB (0x82UL)        // Set callback for release of fragments sent without copying; arg = pointer to ETH_MAC_STM32_TxRelease_t function (0 = none)
+#define ETH_MAC_STM32_RX_COALESCE       (0x83UL)        // Set receive interrupt coalescing; arg = frame count and timeout (see ETH_MAC_STM32_RX_COALESCE_xxx)
+#define ETH_MAC_STM32_RX_FRAMES_LOAN    (0x84UL)        // Get up to max_num received frames without copying; arg = pointer to ETH_MAC_STM32_RX_FRAMES
+#define ETH_MAC_STM32_RX_FRAMES_RELEASE (0x85UL)        // Return num loaned receive DMA buffers to the driver; arg = pointer to ETH_MAC_STM32_RX_FRAMES
+
+// Receive interrupt coalescing argument
+#define ETH_MAC_STM32_RX_COALESCE_FRAMES_Pos     0
+#define ETH_MAC_STM32_RX_COALESCE_FRAMES_Msk    (0xFFUL << ETH_MAC_STM32_RX_COALESCE_FRAMES_Pos)
+#define ETH_MAC_STM32_RX_COALESCE_FRAMES(n)     (((n) << ETH_MAC_STM32_RX_COALESCE_FRAMES_Pos) & ETH_MAC_STM32_RX_COALESCE_FRAMES_Msk)  // Interrupt after n frames (0 or 1 = every frame)
+#define ETH_MAC_STM32_RX_COALESCE_TIME_Pos       16
+#define ETH_MAC_STM32_RX_COALESCE_TIME_Msk      (0xFFFFUL << ETH_MAC_STM32_RX_COALESCE_TIME_Pos)
+#define ETH_MAC_STM32_RX_COALESCE_TIME(us)      (((us) << ETH_MAC_STM32_RX_COALESCE_TIME_Pos) & ETH_MAC_STM32_RX_COALESCE_TIME_Msk)    // Interrupt at latest us microseconds after frame without interrupt (0 = disabled)
+
+// Driver specific SendFrame flags *********************************************
+// (values of the flags not used by the CMSIS-Driver Ethernet MAC API)
+
+#define ETH_MAC_STM32_TX_FRAME_NO_COPY  (1UL << 8)      // Send fragment from caller's buffer without copying (buffer is released with ETH_MAC_STM32_TxRelease_t callback)
+
+// Received frame loan *********************************************************
+
+typedef struct {
+  uint8_t                  *data;       // Pointer to received frame data in receive DMA buffer (set by the driver, NULL = no frame)
+  uint32_t                  len;        // Received frame length in bytes (set by the driver)
+  ARM_ETH_MAC_TIME          time;       // Receive timestamp (set by the driver, if PTP is enabled in HAL)
+} ETH_MAC_STM32_RX_FRAME;
+
+// Received frames loan ********************************************************
+
+typedef struct {
+  ETH_MAC_STM32_RX_FRAME   *frame;      // Pointer to array of received frame information
+  uint32_t                  max_num;    // Maximum number of frames to loan (number of array elements)
+  uint32_t                  num;        // Number of loaned frames (set by the driver) or number of frames to release
+} ETH_MAC_STM32_RX_FRAMES;
+
+// Transmit fragment release callback function type (called for each fragment sent with ETH_MAC_STM32_TX_FRAME_NO_COPY)
+typedef void (*ETH_MAC_STM32_TxRelease_t) (const uint8_t *frame);
+
 // Global driver structures ****************************************************
 
 #ifdef  MX_ETH
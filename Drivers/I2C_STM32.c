@@ -66,10 +66,201 @@ __Functional__ deviations:
   - PowerControl:
     - depends on the code generated by CubeMX.
     - low-power mode is not supported by HAL.
-  - MasterTransmit and SlaveTransmit:
-    - maximum number of data bytes supported by HAL with a single transmit request is 65535.
-  - MasterReceive and SlaveReceive:
-    - maximum number of data bytes supported by HAL with a single receive request is 65535.
+
+# Driver Specific Features
+
+Driver specific Control codes are defined in the **I2C_STM32.h** header file.
+
+## Bus Speed Selection
+
+On device series with I2C peripheral that has the TIMINGR register (for example STM32H7, STM32L4 and STM32U5)
+the TIMINGR value for **ARM_I2C_BUS_SPEED_STANDARD**, **ARM_I2C_BUS_SPEED_FAST** and **ARM_I2C_BUS_SPEED_FAST_PLUS**
+is determined from the I2C peripheral clock and the noise filter settings only once, when the bus speed is first selected
+after the driver was powered up, and is then kept by the driver. Any further bus speed change only writes the TIMINGR register.
+
+TIMINGR values can also be provided at build-time, in which case no calculation is done at run-time,
+by defining **I2Cn_TIMINGR_TABLE** (where n is the instance number) with values for Standard, Fast and Fast+ bus speed,
+for example:
+\code
+#define I2C1_TIMINGR_TABLE  { 0x30909DECU, 0x00F07BFFU, 0x00701F6BU }
+\endcode
+
+  - value 0 in the table means that the TIMINGR value for that bus speed is determined at run-time
+  - build-time values are only used when the peripheral clock and the digital noise filter setting are the same as
+    configured in CubeMX, otherwise the TIMINGR value is determined at run-time
+
+> **Note**
+>
+> - TIMINGR values for the used peripheral clock and filter settings can be obtained from the **Timing** parameter
+>   calculated by CubeMX in the I2C **Parameter Settings**.
+
+## Arbitrary Bus Speed
+
+Besides the standard bus speeds selected with **ARM_I2C_BUS_SPEED**, the SCL frequency can be set in Hz
+with Control code **I2C_STM32_SET_BUS_SPEED_HZ** (arg = SCL frequency, up to 1000000), for example to use
+250 kHz on a bus whose capacitance does not allow Fast mode:
+  - the SCL timing (min SCL low and high periods, data setup and hold times) of the lowest speed class that includes
+    the requested frequency is used: Standard (up to 100 kHz), Fast (up to 400 kHz) or Fast+ (up to 1 MHz)
+  - the fastest setting with SCL frequency not above the requested frequency is selected
+  - **ARM_DRIVER_ERROR_UNSUPPORTED** is returned if the frequency cannot be achieved with the I2C peripheral clock,
+    the lowest frequency is limited by the max SCL low and high periods (for example about 7.8 kHz with 64 MHz
+    I2C peripheral clock, lower with slower peripheral clock)
+
+> **Note**
+>
+> - on device series with I2C peripheral without the TIMINGR register (for example STM32F4) the frequency
+>   is passed to the HAL as clock speed and is limited to 400 kHz.
+
+## Digital Noise Filter Selection
+
+On device series with I2C peripheral that has the TIMINGR register, Control code **I2C_STM32_SET_MAX_DNF**
+(arg = SCL frequency in Hz, up to 1000000) sets the bus speed as **I2C_STM32_SET_BUS_SPEED_HZ** and additionally
+selects the largest digital noise filter coefficient (DNF, 0 .. 15) for which the SCL timing is still met,
+to suppress more noise on noisy boards:
+  - digital filter and TIMINGR are changed together with a single peripheral disable/enable
+  - TIMINGR values kept by the driver for standard bus speeds are discarded if the DNF value changes
+  - **ARM_DRIVER_ERROR_UNSUPPORTED** is returned if the frequency cannot be achieved even without digital filter
+
+> **Note**
+>
+> - the driver keeps a shadow of filter and SMBus settings in the CR1 register and restores them at once
+>   after every HAL_I2C_Init (in **PowerControl** and when Own Slave Address is set).
+
+## Master Transmit and Receive
+
+Typical register read of a sensor (register address write followed by data read with repeated START) can be started
+with a single call of Control code **I2C_STM32_MASTER_TRANSMIT_RECEIVE** with arg pointing to
+an **I2C_STM32_MASTER_XFER** structure that specifies the Slave address, transmit and receive buffers:
+  - reception is started by the driver from the transmit complete interrupt, with repeated START and
+    STOP generated at the end of reception
+  - **ARM_I2C_EVENT_TRANSFER_DONE** event is signaled only once, when reception completes,
+    or together with **ARM_I2C_EVENT_TRANSFER_INCOMPLETE** (and other error events) if the transfer fails
+  - the structure is only read when the transfer is started, so it can be a local variable
+  - **GetDataCount** returns the number of transmitted bytes while transmitting and the number of received bytes while receiving
+
+Example:
+\code
+uint8_t reg = 0x0FU;
+uint8_t val[2];
+I2C_STM32_MASTER_XFER xfer = { 0x48U, &reg, 1U, val, 2U };
+
+Driver_I2C1.Control(I2C_STM32_MASTER_TRANSMIT_RECEIVE, (uint32_t)&xfer);
+\endcode
+
+## Transfer Queue
+
+When several threads share an I2C bus as Master, transfers can be queued with Control code **I2C_STM32_QUEUE_TRANSFER**
+with arg pointing to an **I2C_STM32_QUEUE_XFER** structure, instead of retrying a transfer that was rejected with
+**ARM_DRIVER_ERROR_BUSY**:
+  - queuing is accepted also while a transfer is in progress, the transfer is started immediately if the bus is free
+  - transfer description specifies transmit only (**rx_num** = 0), receive only (**tx_num** = 0) or transmit followed
+    by receive with repeated START (as **I2C_STM32_MASTER_TRANSMIT_RECEIVE**), every queued transfer ends with STOP
+  - transfers are started by the driver from the completion interrupt of the previous transfer in order of
+    **priority** (0 = highest), transfers with same priority in queuing order
+  - completion of a queued transfer is signaled by calling its **cb_xfer** callback (if not NULL) and by setting its
+    **event** member to a non-zero value (**ARM_I2C_EVENT_TRANSFER_DONE** and error events), the driver callback
+    registered with **Initialize** is not called for queued transfers
+  - **ARM_I2C_ABORT_TRANSFER** aborts only the transfer in progress, **PowerControl** completes all queued transfers
+    with **ARM_I2C_EVENT_TRANSFER_INCOMPLETE**
+
+> **Notes**
+>
+> - the **I2C_STM32_QUEUE_XFER** structure and the data buffers are used by the driver until the transfer completes,
+>   so the same structure must not be queued again before its transfer completed.
+> - queued transfers are only started while the peripheral is not used as Slave and no sequence of transfers without
+>   STOP (**xfer_pending** = true) is open, they are started when the Slave transfer or the sequence completes.
+
+## Abort Transfer without Blocking
+
+**ARM_I2C_ABORT_TRANSFER** waits (up to **I2C_XFER_ABORT_TIMEOUT** ms) until the Master transfer abort completes, so it blocks
+the caller and cannot be used from an interrupt routine. Control code **I2C_STM32_ABORT_TRANSFER_ASYNC** starts the abort
+and returns immediately:
+  - completion of the abort is signaled with the **I2C_STM32_EVENT_ABORT_DONE** event (in Slave mode or when no transfer
+    is in progress the event is signaled before the function returns)
+  - arg specifies the max time (in us, up to 1000000) to spin waiting for the abort completion, 0 = do not wait,
+    if the abort did not complete in that time **ARM_DRIVER_ERROR_TIMEOUT** is returned and completion is signaled later
+    with the event
+  - spin time is derived from the core clock (**SystemCoreClock**), actual wait time can be longer than requested
+    as every loop iteration takes more than one clock cycle
+
+## Transfers larger than 65535 bytes
+
+HAL supports up to 65535 data bytes with a single transfer request, larger transfers requested with
+**MasterTransmit**, **MasterReceive**, **SlaveTransmit**, **SlaveReceive**, **I2C_STM32_MASTER_TRANSMIT_RECEIVE**
+or **I2C_STM32_QUEUE_TRANSFER** are split by the driver into chunks of up to 65535 bytes:
+  - all chunks are transferred within the same bus transaction (without repeated START or STOP in between),
+    the next chunk is requested from the completion callback of the previous chunk while SCL is stretched
+  - **ARM_I2C_EVENT_TRANSFER_DONE** is signaled once, after the last chunk completes
+  - **GetDataCount** returns the number of bytes transferred by the whole request
+
+## Slave Receive Stream
+
+For a Slave receiving a continuous stream of write transactions, Control code **I2C_STM32_SLAVE_RECEIVE_STREAM**
+with arg pointing to an **I2C_STM32_SLAVE_STREAM** structure enables reception into a ring buffer without calling
+**SlaveReceive** for every transaction (arg = 0 disables streaming):
+  - Slave address must be set with **ARM_I2C_OWN_ADDRESS**, every write transaction addressed to the Slave is received
+    into the ring buffer (with DMA if it is configured for Rx), consecutive transactions are stored back-to-back
+  - driver advances **head** by the number of received bytes, application advances **tail** by the number of bytes
+    it has read from the ring buffer (both are free running counters, index in the ring buffer is counter modulo **size**,
+    **size** must be a power of 2 (up to 32768) so that the index stays continuous when the counters wrap at 2^32)
+  - end of every write transaction (STOP or repeated START) is signaled with **I2C_STM32_EVENT_SLAVE_STREAM_RECEIVE**
+    event, number of bytes received by the transaction is in **xfer_num** member of the structure
+  - ring buffer is not full-checked while receiving, if unread data was overwritten
+    **I2C_STM32_EVENT_SLAVE_STREAM_OVERFLOW** event is signaled together with the end of transaction
+  - Master read requests are handled as without streaming (with **SlaveTransmit** or **ARM_I2C_EVENT_SLAVE_TRANSMIT** event)
+
+> **Notes**
+>
+> - reception is requested from HAL up to the end of ring buffer and restarted from its beginning when the end is reached,
+>   SCL is stretched during the restart, so the ring buffer should be large enough to contain several transactions.
+> - **SlaveReceive** returns **ARM_DRIVER_ERROR** and register file emulation cannot be enabled while streaming is enabled.
+
+## SMBus
+
+I2C peripherals with TIMINGR register support SMBus features that are configured with Control codes
+(on other I2C peripherals these Control codes return **ARM_DRIVER_ERROR_UNSUPPORTED**):
+  - **I2C_STM32_SMBUS_PEC** enables hardware PEC (Packet Error Checking, CRC-8): for Master transfers ending with STOP
+    the last byte of data buffer is the PEC byte, on transmit it is replaced by PEC calculated by hardware,
+    on receive it is checked by hardware and mismatch is signaled with **I2C_STM32_EVENT_SMBUS_PEC_ERROR** event
+    (together with **ARM_I2C_EVENT_TRANSFER_DONE**)
+  - **I2C_STM32_SMBUS_ALERT** enables SMBus Host and detection of SMBALERT signal on SMBA pin,
+    detection is signaled with **I2C_STM32_EVENT_SMBUS_ALERT** event
+  - **I2C_STM32_SMBUS_TIMEOUT** sets the TIMEOUTR register (arg is register value as **SMBusTimeout** of HAL SMBUS),
+    detected timeout is signaled with **I2C_STM32_EVENT_SMBUS_TIMEOUT** event
+  - **I2C_STM32_SMBUS_CHECK_FLAGS** checks SMBus flags and signals SMBus events,
+    it can be called any time (for example to poll for SMBALERT while no transfer is in progress)
+
+> **Notes**
+>
+> - HAL I2C error interrupt handler does not process SMBus flags, so the driver provides the error interrupt handler
+>   (**I2Cn_ER_IRQHandler**, **Generate IRQ handler** must be unchecked for the I2C error interrupt) that clears them
+>   before calling **HAL_I2C_ER_IRQHandler**: SMBALERT and timeout are signaled immediately,
+>   PEC error is signaled together with **ARM_I2C_EVENT_TRANSFER_DONE**.
+> - on devices where I2C event and error interrupts share one vector, define **I2Cn_ER_IRQ_HANDLER** (n = instance)
+>   with another function name and call that function instead of **HAL_I2C_ER_IRQHandler** from the generated handler,
+>   and define **I2Cn_EV_IRQ_NUM** and **I2Cn_ER_IRQ_NUM** as **I2Cn_IRQn** (the driver masks the instance interrupts
+>   while it starts a transfer).
+> - PEC is not supported for Slave transfers.
+> - SMBus configuration is disabled by **PowerControl**.
+
+## Slave Register File
+
+Typical register based Slave device (sensor, EEPROM like memory) can be emulated without application involvement
+per transfer with Control code **I2C_STM32_SET_SLAVE_REG_FILE** with arg pointing to an **I2C_STM32_SLAVE_REG_FILE**
+structure describing the register file (arg = 0 disables the emulation):
+  - Slave address must be set with **ARM_I2C_OWN_ADDRESS** and the register file must be set while Slave is not accessed
+  - first byte written by the Master is the register address (modulo register file **size**), it sets the register
+    pointer, following written bytes are stored to registers from the register pointer on
+  - Master reads return registers from the register pointer on (as set by the last write or read)
+  - register pointer is incremented with every written and read byte and wraps around at the end of the register file
+  - write of registers is signaled with the **I2C_STM32_EVENT_SLAVE_REG_WRITE** event after STOP, written registers
+    are specified in **wr_addr** and **wr_num** members of the structure
+  - **ARM_I2C_SlaveTransmit** and **ARM_I2C_SlaveReceive** return **ARM_DRIVER_ERROR** while emulation is enabled
+
+> **Notes**
+>
+> - if several register blocks are written within one transaction (with repeated START) only the last one is reported.
+> - register file is accessed in interrupt mode (DMA is not used) and emulation is disabled by **PowerControl**.
 
 # CubeMX Configuration
 
@@ -148,7 +339,7 @@ This driver requires the following configuration in CubeMX:
            DMA1 stream0 global interrupt     | unchecked   | checked             | checked          | checked
            DMA1 stream1 global interrupt     | unchecked   | checked             | checked          | checked
            I2C1 event interrupt              | unchecked   | checked             | checked          | checked
-           I2C1 error interrupt              | unchecked   | checked             | checked          | checked
+           I2C1 error interrupt              | unchecked   | checked             | **unchecked**    | unchecked
          \n
 
 ### Clock Configuration tab
@@ -282,6 +473,13 @@ static const ARM_I2C_CAPABILITIES driver_capabilities = {
 #define I2Cn_SECTION(n)
 #endif
 
+#ifdef  I2C_VARIANT_TIMINGR     // If TIMINGR register exists
+// Macro for build-time TIMINGR values (for instances)
+#define INFO_TIMINGR_DEFINE(n)  , I2C##n##_TIMINGR_TABLE
+#else
+#define INFO_TIMINGR_DEFINE(n)
+#endif
+
 #ifdef  I2C_VARIANT_HAS_FILTER  // If I2C peripheral has filters
 // Macro to create i2c_ro_info and i2c_rw_info (for instances), with filter settings
 #define INFO_DEFINE(n)                                                                                         \
@@ -302,8 +500,11 @@ static  const RO_Info_t         i2c##n##_ro_info    = { &hi2c##n,
                                                            MX_I2C##n##_SDA_GPIO_PuPd,                          \
                                                            MX_I2C##n##_SDA_GPIO_Speed                          \
                                                          },                                                    \
+                                                         I2C##n##_EV_IRQ_NUM,                                  \
+                                                         I2C##n##_ER_IRQ_NUM,                                  \
                                                          MX_I2C##n##_ANF_ENABLE,                               \
                                                          MX_I2C##n##_DNF                                       \
+                                                         INFO_TIMINGR_DEFINE(n)                                \
                                                       };
 #else
 // Macro to create i2c_ro_info and i2c_rw_info (for instances), without filter settings
@@ -324,10 +525,22 @@ static  const RO_Info_t         i2c##n##_ro_info    = { &hi2c##n,
                                                            MX_I2C##n##_SDA_GPIO_AF,                            \
                                                            MX_I2C##n##_SDA_GPIO_PuPd,                          \
                                                            MX_I2C##n##_SDA_GPIO_Speed                          \
-                                                         }                                                     \
+                                                         },                                                    \
+                                                         I2C##n##_EV_IRQ_NUM,                                  \
+                                                         I2C##n##_ER_IRQ_NUM                                   \
+                                                         INFO_TIMINGR_DEFINE(n)                                \
                                                       };
 #endif
 
+#ifdef  I2C_VARIANT_TIMINGR     // If TIMINGR register exists
+// Macros for declaring and defining error interrupt handler (for instances)
+#define FUNCS_ER_IRQ_DECLARE(n) void I2C##n##_ER_IRQ_HANDLER (void);
+#define FUNCS_ER_IRQ_DEFINE(n)  void I2C##n##_ER_IRQ_HANDLER (void) { I2Cn_ER_IRQHandler(&i2c##n##_ro_info); }
+#else
+#define FUNCS_ER_IRQ_DECLARE(n)
+#define FUNCS_ER_IRQ_DEFINE(n)
+#endif
+
 // Macro for declaring functions (for instances)
 #define FUNCS_DECLARE(n)                                                                                       \
 static  int32_t                 I2C##n##_Initialize      (ARM_I2C_SignalEvent_t cb_event);                     \
@@ -339,7 +552,8 @@ static  int32_t                 I2C##n##_SlaveTransmit   (               const u
 static  int32_t                 I2C##n##_SlaveReceive    (                     uint8_t *data, uint32_t num);   \
 static  int32_t                 I2C##n##_GetDataCount    (void);                                               \
 static  int32_t                 I2C##n##_Control         (uint32_t control, uint32_t arg);                     \
-static  ARM_I2C_STATUS          I2C##n##_GetStatus       (void);
+static  ARM_I2C_STATUS          I2C##n##_GetStatus       (void);                                               \
+        FUNCS_ER_IRQ_DECLARE(n)
 
 // Macro for defining functions (for instances)
 #define FUNCS_DEFINE(n)                                                                                                                                                                                             \
@@ -352,7 +566,8 @@ static  int32_t                 I2C##n##_SlaveTransmit   (               const u
 static  int32_t                 I2C##n##_SlaveReceive    (                     uint8_t *data, uint32_t num)                     { return I2Cn_SlaveReceive    (&i2c##n##_ro_info, data, num); }                     \
 static  int32_t                 I2C##n##_GetDataCount    (void)                                                                 { return I2Cn_GetDataCount    (&i2c##n##_ro_info); }                                \
 static  int32_t                 I2C##n##_Control         (uint32_t control, uint32_t arg)                                       { return I2Cn_Control         (&i2c##n##_ro_info, control, arg); }                  \
-static  ARM_I2C_STATUS          I2C##n##_GetStatus       (void)                                                                 { return I2Cn_GetStatus       (&i2c##n##_ro_info); }
+static  ARM_I2C_STATUS          I2C##n##_GetStatus       (void)                                                                 { return I2Cn_GetStatus       (&i2c##n##_ro_info); }                                \
+        FUNCS_ER_IRQ_DEFINE(n)
 
 // Macro for defining driver structures (for instances)
 #define I2C_DRIVER(n)                   \
@@ -381,6 +596,99 @@ ARM_DRIVER_I2C Driver_I2C##n = {        \
 #define I2C_BUS_CLEAR_CLOCK_PERIOD     (2U)             // I2C bus clock period (in ms)
 #endif
 
+// Transfer chunk definitions
+#define I2C_XFER_CHUNK_MAX             (UINT16_MAX)     // Max number of bytes requested from HAL at once (HAL transfer size is 16-bit)
+
+// Event and error interrupt numbers (on devices with shared event/error vector define both as I2Cn_IRQn)
+#ifndef I2C1_EV_IRQ_NUM
+#define I2C1_EV_IRQ_NUM                I2C1_EV_IRQn
+#endif
+#ifndef I2C1_ER_IRQ_NUM
+#define I2C1_ER_IRQ_NUM                I2C1_ER_IRQn
+#endif
+#ifndef I2C2_EV_IRQ_NUM
+#define I2C2_EV_IRQ_NUM                I2C2_EV_IRQn
+#endif
+#ifndef I2C2_ER_IRQ_NUM
+#define I2C2_ER_IRQ_NUM                I2C2_ER_IRQn
+#endif
+#ifndef I2C3_EV_IRQ_NUM
+#define I2C3_EV_IRQ_NUM                I2C3_EV_IRQn
+#endif
+#ifndef I2C3_ER_IRQ_NUM
+#define I2C3_ER_IRQ_NUM                I2C3_ER_IRQn
+#endif
+#ifndef I2C4_EV_IRQ_NUM
+#define I2C4_EV_IRQ_NUM                I2C4_EV_IRQn
+#endif
+#ifndef I2C4_ER_IRQ_NUM
+#define I2C4_ER_IRQ_NUM                I2C4_ER_IRQn
+#endif
+#ifndef I2C5_EV_IRQ_NUM
+#define I2C5_EV_IRQ_NUM                I2C5_EV_IRQn
+#endif
+#ifndef I2C5_ER_IRQ_NUM
+#define I2C5_ER_IRQ_NUM                I2C5_ER_IRQn
+#endif
+#ifndef I2C6_EV_IRQ_NUM
+#define I2C6_EV_IRQ_NUM                I2C6_EV_IRQn
+#endif
+#ifndef I2C6_ER_IRQ_NUM
+#define I2C6_ER_IRQ_NUM                I2C6_ER_IRQn
+#endif
+#ifndef I2C7_EV_IRQ_NUM
+#define I2C7_EV_IRQ_NUM                I2C7_EV_IRQn
+#endif
+#ifndef I2C7_ER_IRQ_NUM
+#define I2C7_ER_IRQ_NUM                I2C7_ER_IRQn
+#endif
+#ifndef I2C8_EV_IRQ_NUM
+#define I2C8_EV_IRQ_NUM                I2C8_EV_IRQn
+#endif
+#ifndef I2C8_ER_IRQ_NUM
+#define I2C8_ER_IRQ_NUM                I2C8_ER_IRQn
+#endif
+
+#ifdef  I2C_VARIANT_TIMINGR                             // If TIMINGR register exists
+// Error interrupt handlers (driver clears SMBus flags that HAL_I2C_ER_IRQHandler does not process)
+#ifndef I2C1_ER_IRQ_HANDLER
+#define I2C1_ER_IRQ_HANDLER            I2C1_ER_IRQHandler
+#endif
+#ifndef I2C2_ER_IRQ_HANDLER
+#define I2C2_ER_IRQ_HANDLER            I2C2_ER_IRQHandler
+#endif
+#ifndef I2C3_ER_IRQ_HANDLER
+#define I2C3_ER_IRQ_HANDLER            I2C3_ER_IRQHandler
+#endif
+#ifndef I2C4_ER_IRQ_HANDLER
+#define I2C4_ER_IRQ_HANDLER            I2C4_ER_IRQHandler
+#endif
+#ifndef I2C5_ER_IRQ_HANDLER
+#define I2C5_ER_IRQ_HANDLER            I2C5_ER_IRQHandler
+#endif
+#ifndef I2C6_ER_IRQ_HANDLER
+#define I2C6_ER_IRQ_HANDLER            I2C6_ER_IRQHandler
+#endif
+#ifndef I2C7_ER_IRQ_HANDLER
+#define I2C7_ER_IRQ_HANDLER            I2C7_ER_IRQHandler
+#endif
+#ifndef I2C8_ER_IRQ_HANDLER
+#define I2C8_ER_IRQ_HANDLER            I2C8_ER_IRQHandler
+#endif
+#endif
+
+// Transfer types (for chunked transfers)
+#define I2C_XFER_MASTER_TX             (0U)             // Master transmit
+#define I2C_XFER_MASTER_RX             (1U)             // Master receive
+#define I2C_XFER_SLAVE_TX              (2U)             // Slave transmit
+#define I2C_XFER_SLAVE_RX              (3U)             // Slave receive
+
+// Slave register file access states
+#define I2C_REG_STATE_IDLE             (0U)             // No register file access in progress
+#define I2C_REG_STATE_ADDR             (1U)             // Receiving register address
+#define I2C_REG_STATE_WRITE            (2U)             // Receiving register data
+#define I2C_REG_STATE_READ             (3U)             // Transmitting register data
+
 #ifdef  I2C_VARIANT_TIMINGR                             // If TIMINGR register exists
 
 // TIMING register limit values
@@ -398,6 +706,41 @@ ARM_DRIVER_I2C Driver_I2C##n = {        \
 #define I2C_ANALOG_FILTER_DELAY_MAX     260U            // Max delay added by the analog filter (in ns)
 #endif
 
+// CR1 register bits that HAL_I2C_Init does not preserve (filters and SMBus settings)
+#define I2C_CR1_SHADOW_MASK            (I2C_CR1_ANFOFF | I2C_CR1_DNF | I2C_CR1_PECEN | I2C_CR1_SMBHEN | I2C_CR1_ALERTEN)
+
+// Max value of the digital noise filter coefficient (DNF)
+#define I2C_DNF_MAX                    (15U)
+
+// Number of bus speeds with precomputed TIMINGR value (Standard, Fast and Fast+)
+#define I2C_BUS_SPEED_NUM              (3U)
+
+// Build-time TIMINGR values for Standard, Fast and Fast+ bus speed, 0 = determined at run-time
+#ifndef I2C1_TIMINGR_TABLE
+#define I2C1_TIMINGR_TABLE              { 0U, 0U, 0U }
+#endif
+#ifndef I2C2_TIMINGR_TABLE
+#define I2C2_TIMINGR_TABLE              { 0U, 0U, 0U }
+#endif
+#ifndef I2C3_TIMINGR_TABLE
+#define I2C3_TIMINGR_TABLE              { 0U, 0U, 0U }
+#endif
+#ifndef I2C4_TIMINGR_TABLE
+#define I2C4_TIMINGR_TABLE              { 0U, 0U, 0U }
+#endif
+#ifndef I2C5_TIMINGR_TABLE
+#define I2C5_TIMINGR_TABLE              { 0U, 0U, 0U }
+#endif
+#ifndef I2C6_TIMINGR_TABLE
+#define I2C6_TIMINGR_TABLE              { 0U, 0U, 0U }
+#endif
+#ifndef I2C7_TIMINGR_TABLE
+#define I2C7_TIMINGR_TABLE              { 0U, 0U, 0U }
+#endif
+#ifndef I2C8_TIMINGR_TABLE
+#define I2C8_TIMINGR_TABLE              { 0U, 0U, 0U }
+#endif
+
 // I2C standard timing specification
 typedef struct {
   uint32_t                      clk_max;                // Max I2C speed (in Hz)
@@ -412,12 +755,12 @@ typedef struct {
 
 // I2C clock setup auxiliary structure
 typedef struct {
-  uint16_t                      i2cclk;                 // Kernel clock period (in ns)
-  uint16_t                      busclk;                 // Bus clock period (in ns)
-  uint16_t                      dfd;                    // Digital filter delay (in ns)
-  uint16_t                      afd_min;                // Analog filter min delay (in ns)
-  uint16_t                      afd_max;                // Analog filter max delay (in ns)
-  uint16_t                      error;                  // Clock setup error (ns)
+  uint32_t                      i2cclk;                 // Kernel clock period (in ns)
+  uint32_t                      busclk;                 // Bus clock period (in ns)
+  uint32_t                      dfd;                    // Digital filter delay (in ns)
+  uint32_t                      afd_min;                // Analog filter min delay (in ns)
+  uint32_t                      afd_max;                // Analog filter max delay (in ns)
+  uint32_t                      error;                  // Clock setup error (ns)
 } ClockSetup_t;
 
 // I2C peripheral TIMING register values
@@ -457,12 +800,41 @@ typedef struct {
   volatile uint8_t              i2c_bus_error;          // I2C Bus error detected (cleared on start of next Master/Slave operation)
            uint8_t              xfer_no_stop;           // Transfer not generating STOP: 0 - not generating STOP, not 0 - generating STOP
   volatile uint8_t              xfer_abort;             // Transfer abort done: 0 - abort not done might be in progress, not 0 - abort done
-           uint8_t              reserved;               // Reserved (for padding)
-           uint32_t             xfer_size;              // Requested transfer size (in bytes)
+  volatile uint8_t              xfer_abort_async;       // Transfer abort without blocking in progress: 0 - not in progress, not 0 - in progress
+           uint32_t             xfer_size;              // Size of transfer chunk requested from HAL (in bytes)
+           uint32_t             xfer_done;              // Number of bytes transferred by previous chunks of the transfer
+           uint32_t             xfer_rem;               // Number of bytes to be transferred by next chunks of the transfer
+           uint8_t             *xfer_next_data;         // Pointer to data of next chunk of the transfer
+           uint32_t             xfer_last_opt;          // HAL transfer option for last chunk of the transfer (for Master only)
   const    uint8_t * volatile   slave_xfer_tx_data;     // Pointer to transmit data (for Slave only)
            uint8_t * volatile   slave_xfer_rx_data;     // Pointer to receive  data (for Slave only)
-           uint16_t             slave_xfer_tx_num;      // Requested number of bytes to transmit
-           uint16_t             slave_xfer_rx_num;      // Requested number of bytes to receive
+           uint32_t             slave_xfer_tx_num;      // Requested number of bytes to transmit
+           uint32_t             slave_xfer_rx_num;      // Requested number of bytes to receive
+           uint8_t * volatile   master_xfer_rx_data;    // Pointer to receive data started after transmit (for Master transmit and receive only)
+           uint32_t             master_xfer_rx_num;     // Requested number of bytes to receive after transmit
+           uint16_t             master_xfer_saddr;      // Slave address of Master transfer (in HAL format)
+  I2C_STM32_SLAVE_REG_FILE     *reg_file;               // Slave register file (NULL = register file emulation disabled)
+  volatile uint8_t              reg_state;              // Slave register file access state (I2C_REG_STATE_xxx)
+           uint8_t              reg_addr;               // Received register address
+           uint16_t             reg_ptr;                // Register pointer
+           uint16_t             reg_seg_num;            // Number of bytes requested from HAL in current segment of access
+           uint16_t             reg_blk_addr;           // First register of block being written
+           uint16_t             reg_blk_num;            // Number of registers of block being written in previous segments
+           uint16_t             reg_wr_addr;            // First register of last written block (to be reported after STOP)
+           uint16_t             reg_wr_num;             // Number of registers of last written block (0 = nothing written)
+  I2C_STM32_SLAVE_STREAM       *stream;                 // Slave receive stream (NULL = streaming disabled)
+  volatile uint8_t              stream_active;          // Slave receive stream write transaction in progress
+           uint32_t             stream_seg_num;         // Number of bytes requested from HAL in current segment of transaction
+           uint32_t             stream_xfer_num;        // Number of bytes received in previous segments of transaction
+  I2C_STM32_QUEUE_XFER         *queue_head;             // First queued Master transfer (queue is sorted by priority)
+  I2C_STM32_QUEUE_XFER * volatile queue_active;         // Queued Master transfer in progress
+#ifdef I2C_VARIANT_TIMINGR
+           uint32_t             timingr_clk;            // Peripheral clock frequency for which TIMINGR values were determined (in Hz)
+           uint32_t             timingr[I2C_BUS_SPEED_NUM]; // TIMINGR values determined at run-time (0 = not determined yet)
+           uint32_t             cr1;                    // Shadow of CR1 register bits not preserved by HAL_I2C_Init (I2C_CR1_SHADOW_MASK)
+           uint32_t             timing_mx;              // TIMINGR value configured at build-time (Init.Timing before any change by the driver)
+  volatile uint32_t             smbus_isr;              // SMBus flags cleared by error interrupt handler (not yet signaled)
+#endif
 } RW_Info_t;
 
 // Instance compile-time information (RO)
@@ -473,10 +845,15 @@ typedef struct {
   uint32_t                      peri_clock_freq;        // Peripheral clock frequency (in Hz)
   PinConfig_t                   scl_pin_config;         // SCL pin configuration structure
   PinConfig_t                   sda_pin_config;         // SDA pin configuration structure
+  IRQn_Type                     irq_ev;                 // Event interrupt number
+  IRQn_Type                     irq_er;                 // Error interrupt number
 #ifdef I2C_VARIANT_HAS_FILTER
   uint16_t                      anf_en;                 // Analog noise filter enable
   uint16_t                      dnf;                    // Digital noise filter coefficient value (0 - disabled)
 #endif
+#ifdef I2C_VARIANT_TIMINGR
+  uint32_t                      timingr[I2C_BUS_SPEED_NUM]; // Build-time TIMINGR values (0 = determine at run-time)
+#endif
 } RO_Info_t;
 
 // Information definitions (for instances)
@@ -576,8 +953,12 @@ static const RO_Info_t * const i2c_ro_info_list[] = {
 static const RO_Info_t         *I2C_GetInfo         (const I2C_HandleTypeDef * const hi2c);
 static uint32_t                 I2Cn_GetPeriphClock (const RO_Info_t * const ptr_ro_info);
 #ifdef I2C_VARIANT_TIMINGR      // If TIMINGR register exists
+static uint32_t                 I2Cn_GetMinCount    (uint32_t t_min, uint32_t t_offset, uint32_t t_step);
 static int32_t                  I2Cn_GetSCLRatio    (ClockSetup_t *ptr_clock_setup, const StandardTiming_t *ptr_timing_spec, TimingReg_t *ptr_timing_reg);
 static uint32_t                 I2Cn_GetTimingValue (ClockSetup_t *ptr_clock_setup, const StandardTiming_t *ptr_timing_spec);
+static uint32_t                 I2Cn_CalcTiming     (const RO_Info_t * const ptr_ro_info, uint32_t periph_clk, const StandardTiming_t *ptr_timing_spec, uint32_t scl_freq, uint32_t dnf);
+static uint32_t                 I2Cn_GetTiming      (const RO_Info_t * const ptr_ro_info, uint32_t periph_clk, uint32_t bus_speed);
+static uint32_t                 I2Cn_GetTimingFreq  (const RO_Info_t * const ptr_ro_info, uint32_t periph_clk, uint32_t scl_freq, uint32_t dnf);
 #endif
 static ARM_DRIVER_VERSION       I2C_GetVersion      (void);
 static ARM_I2C_CAPABILITIES     I2C_GetCapabilities (void);
@@ -586,8 +967,33 @@ static int32_t                  I2Cn_Uninitialize   (const RO_Info_t * const ptr
 static int32_t                  I2Cn_PowerControl   (const RO_Info_t * const ptr_ro_info, ARM_POWER_STATE state);
 static int32_t                  I2Cn_MasterTransmit (const RO_Info_t * const ptr_ro_info, uint32_t addr, const uint8_t *data, uint32_t num, bool xfer_pending);
 static int32_t                  I2Cn_MasterReceive  (const RO_Info_t * const ptr_ro_info, uint32_t addr,       uint8_t *data, uint32_t num, bool xfer_pending);
+static int32_t                  I2Cn_MasterTransmitReceive (const RO_Info_t * const ptr_ro_info, const I2C_STM32_MASTER_XFER *xfer);
+static int32_t                  I2Cn_QueueTransfer  (const RO_Info_t * const ptr_ro_info, I2C_STM32_QUEUE_XFER *qxfer);
+static void                     I2Cn_QueueStartNext (const RO_Info_t * const ptr_ro_info);
+static uint32_t                 I2Cn_QueueComplete  (const RO_Info_t * const ptr_ro_info, uint32_t event);
+static void                     I2Cn_QueueFlush     (const RO_Info_t * const ptr_ro_info);
+static uint32_t                 I2Cn_IrqDisable     (const RO_Info_t * const ptr_ro_info);
+static void                     I2Cn_IrqRestore     (const RO_Info_t * const ptr_ro_info, uint32_t irq_en);
+static HAL_StatusTypeDef        I2Cn_XferChunk      (const RO_Info_t * const ptr_ro_info, uint32_t xfer_type, uint16_t saddr, uint8_t *data, uint32_t num, uint32_t opt);
+static HAL_StatusTypeDef        I2Cn_XferStart      (const RO_Info_t * const ptr_ro_info, uint32_t xfer_type, uint16_t saddr, uint8_t *data, uint32_t num, uint32_t opt);
+static uint32_t                 I2Cn_XferContinue   (const RO_Info_t * const ptr_ro_info, uint32_t xfer_type);
+#ifdef  I2C_VARIANT_TIMINGR
+static void                     I2Cn_ApplyCR1       (const RO_Info_t * const ptr_ro_info);
+#endif
+static int32_t                  I2Cn_PeriphInit     (const RO_Info_t * const ptr_ro_info);
+static uint32_t                 I2Cn_SMBusFlags     (const RO_Info_t * const ptr_ro_info);
+#ifdef  I2C_VARIANT_TIMINGR
+static void                     I2Cn_ER_IRQHandler  (const RO_Info_t * const ptr_ro_info);
+#endif
+static void                     I2Cn_StreamArm      (const RO_Info_t * const ptr_ro_info);
+static void                     I2Cn_StreamEnd      (const RO_Info_t * const ptr_ro_info);
+static void                     I2Cn_RegFileAddr    (const RO_Info_t * const ptr_ro_info, uint8_t direction);
+static void                     I2Cn_RegFileXferCplt(const RO_Info_t * const ptr_ro_info);
+static void                     I2Cn_RegFileAccessEnd(const RO_Info_t * const ptr_ro_info);
+static void                     I2Cn_RegFileStop    (const RO_Info_t * const ptr_ro_info);
 static int32_t                  I2Cn_SlaveTransmit  (const RO_Info_t * const ptr_ro_info,                const uint8_t *data, uint32_t num);
 static int32_t                  I2Cn_SlaveReceive   (const RO_Info_t * const ptr_ro_info,                      uint8_t *data, uint32_t num);
+static int32_t                  I2Cn_AbortTransferAsync (const RO_Info_t * const ptr_ro_info, uint32_t spin_us);
 static int32_t                  I2Cn_GetDataCount   (const RO_Info_t * const ptr_ro_info);
 static int32_t                  I2Cn_Control        (const RO_Info_t * const ptr_ro_info, uint32_t control, uint32_t arg);
 static ARM_I2C_STATUS           I2Cn_GetStatus      (const RO_Info_t * const ptr_ro_info);
@@ -657,6 +1063,23 @@ static uint32_t I2Cn_GetPeriphClock (const RO_Info_t * const ptr_ro_info) {
 }
 
 #ifdef  I2C_VARIANT_TIMINGR             // If TIMINGR register exists
+/**
+  \fn          uint32_t I2Cn_GetMinCount (uint32_t t_min, uint32_t t_offset, uint32_t t_step)
+  \brief       Get smallest register value n for which period ((n + 1) * t_step) + t_offset is at least t_min.
+  \param[in]   t_min       Min period (in ns)
+  \param[in]   t_offset    Period offset (in ns)
+  \param[in]   t_step      Period step per register value increment (in ns)
+  \return      register value
+*/
+static uint32_t I2Cn_GetMinCount (uint32_t t_min, uint32_t t_offset, uint32_t t_step) {
+
+  if (t_min <= (t_offset + t_step)) {
+    return 0U;
+  }
+
+  return ((((t_min - t_offset) + t_step) - 1U) / t_step) - 1U;
+}
+
 /**
   \fn          int32_t I2Cn_GetSCLRatio (ClockSetup_t *ptr_clock_setup, StandardTiming_t *ptr_timing_spec, TimingReg_t *ptr_timing_reg)
   \brief       Evaluate SCL low/high ratio.
@@ -669,11 +1092,14 @@ static int32_t I2Cn_GetSCLRatio (ClockSetup_t *ptr_clock_setup, const StandardTi
   uint32_t clk_max, clk_min;
   uint32_t tpresc, tsync;
   uint32_t tscl, tscll, tsclh;
-  uint32_t scll, sclh;
-  int32_t  err;
+  uint32_t tscl_min, tscll_min, tsclh_min;
+  uint32_t scll, sclh, n;
 
   // Set minimum bus clock frequency to 80% of max
   clk_min = (ptr_timing_spec->clk_max * 80) / 100;
+  if (clk_min == 0U) {
+    clk_min = 1U;
+  }
 
   // Convert values to ns
   clk_max = 1000000000U / clk_min;
@@ -681,33 +1107,48 @@ static int32_t I2Cn_GetSCLRatio (ClockSetup_t *ptr_clock_setup, const StandardTi
   tsync   = ptr_clock_setup->afd_min + ptr_clock_setup->dfd + (2 * ptr_clock_setup->i2cclk);
   tpresc  = (ptr_timing_reg->presc + 1U) * ptr_clock_setup->i2cclk;
 
-  err = 0;
+  // Min SCL low period: specification, and longer than 4 kernel clocks after filter delays
+  tscll_min = ptr_clock_setup->afd_min + ptr_clock_setup->dfd + (4U * (ptr_clock_setup->i2cclk + 1U));
+  if (tscll_min < ptr_timing_spec->scll_min) {
+    tscll_min = ptr_timing_spec->scll_min;
+  }
 
-  // Evaluate all values of SCLL and SCLH
-  for (scll = 0U; scll < I2C_TIMINGR_SCLL_MAX; scll++) {
-    tscll = ((scll + 1U) * tpresc) + tsync;
+  // Min SCL high period: specification, and longer than 1 kernel clock
+  tsclh_min = ptr_clock_setup->i2cclk + 1U;
+  if (tsclh_min < ptr_timing_spec->sclh_min) {
+    tsclh_min = ptr_timing_spec->sclh_min;
+  }
 
-    if ((tscll >= ptr_timing_spec->scll_min) && (ptr_clock_setup->i2cclk < ((tscll - (ptr_clock_setup->afd_min + ptr_clock_setup->dfd)) / 4))) {
-      // SCL low meets specification
+  // Min SCL period: not shorter than bus clock period and specification
+  tscl_min = ptr_clock_setup->busclk;
+  if (tscl_min < clk_min) {
+    tscl_min = clk_min;
+  }
 
-      for (sclh = 0U; sclh < I2C_TIMINGR_SCLH_MAX; sclh++) {
-        tsclh = ((sclh + 1U) * tpresc) + tsync;
+  // Starting with the shortest SCL low period that meets specification,
+  // find the first SCL low period for which an SCL high period exists so that the SCL period is in range
+  for (scll = I2Cn_GetMinCount(tscll_min, tsync, tpresc); scll < I2C_TIMINGR_SCLL_MAX; scll++) {
+    tscll = ((scll + 1U) * tpresc) + tsync;
 
-        if ((tsclh >= ptr_timing_spec->sclh_min) && (tsclh > ptr_clock_setup->i2cclk)) {
-          // SCL high meets specification
-          tscl = tscll + tsclh;
+    // Shortest SCL high period that meets specification and min SCL period
+    sclh = I2Cn_GetMinCount(tsclh_min, tsync, tpresc);
+    if (tscll < tscl_min) {
+      n = I2Cn_GetMinCount(tscl_min - tscll, tsync, tpresc);
+      if (n > sclh) {
+        sclh = n;
+      }
+    }
 
-          if ((tscl >= clk_min) && (tscl <= clk_max)) {
-            // Evaluate SCL period error
-            err = (int32_t)(tscl - ptr_clock_setup->busclk);
+    if (sclh < I2C_TIMINGR_SCLH_MAX) {
+      tsclh = ((sclh + 1U) * tpresc) + tsync;
+      tscl  = tscll + tsclh;
 
-            if (err >= 0) {
-              ptr_timing_reg->sclh = (uint8_t)sclh;
-              ptr_timing_reg->scll = (uint8_t)scll;
-              return (err);
-            }
-          }
-        }
+      if (tscl <= clk_max) {
+        ptr_timing_reg->sclh = (uint8_t)sclh;
+        ptr_timing_reg->scll = (uint8_t)scll;
+
+        // Return SCL period error
+        return ((int32_t)(tscl - ptr_clock_setup->busclk));
       }
     }
   }
@@ -725,23 +1166,15 @@ static int32_t I2Cn_GetSCLRatio (ClockSetup_t *ptr_clock_setup, const StandardTi
 */
 static uint32_t I2Cn_GetTimingValue (ClockSetup_t *ptr_clock_setup, const StandardTiming_t *ptr_timing_spec) {
   TimingReg_t timing_reg;
-  uint32_t    dnf_en;
   uint32_t    presc;
-  uint32_t    sdadel, sdadel_min, sdadel_max;
-  uint32_t    scldel, scldel_min;
+  uint32_t    sdadel_min, sdadel_max;
+  uint32_t    scldel_min;
   uint32_t    p, l, a;
   uint32_t    timing;
   int32_t     val, err;
 
-  // Set digital noise filter enabled flag
-  if (ptr_clock_setup->dfd > 0U) {
-    dnf_en = 1U;
-  } else {
-    dnf_en = 0U;
-  }
-
-  // SDADEL (max)
-  val = (int32_t)(ptr_timing_spec->vddat_max - (ptr_timing_spec->tr_max + ptr_clock_setup->afd_max + ((dnf_en + 4) * ptr_clock_setup->i2cclk)));
+  // SDADEL (max): tVD;DAT(max) - tr(max) - tAF(max) - tDNF - 4 * tI2CCLK
+  val = (int32_t)(ptr_timing_spec->vddat_max - (ptr_timing_spec->tr_max + ptr_clock_setup->afd_max + ptr_clock_setup->dfd + (4U * ptr_clock_setup->i2cclk)));
 
   if (val > 0) {
     sdadel_max = (uint32_t)val;
@@ -749,8 +1182,8 @@ static uint32_t I2Cn_GetTimingValue (ClockSetup_t *ptr_clock_setup, const Standa
     sdadel_max = 0U;
   }
 
-  // SDADEL (min)
-  val = (int32_t)(ptr_timing_spec->tf_max + ptr_timing_spec->hddat_min - (ptr_clock_setup->afd_min + ((dnf_en + 3) * ptr_clock_setup->i2cclk)));
+  // SDADEL (min): tf(max) + tHD;DAT(min) - tAF(min) - tDNF - 3 * tI2CCLK
+  val = (int32_t)(ptr_timing_spec->tf_max + ptr_timing_spec->hddat_min - (ptr_clock_setup->afd_min + ptr_clock_setup->dfd + (3U * ptr_clock_setup->i2cclk)));
 
   if (val > 0) {
     sdadel_min = (uint32_t)val;
@@ -764,43 +1197,44 @@ static uint32_t I2Cn_GetTimingValue (ClockSetup_t *ptr_clock_setup, const Standa
   // Set timing register max value
   timing = 0xF0FFFFFFU;
 
-  // Evaluate all values of PRESC, SCLDEL and SDADEL
+  // Evaluate all values of PRESC, SCL low/high ratio does not depend on SCLDEL and SDADEL
+  // so only the smallest valid SCLDEL and SDADEL values are used
   for (p = 0U; p < I2C_TIMINGR_PRESC_MAX; p++) {
     presc = (p + 1U) * ptr_clock_setup->i2cclk;
 
-    for (l = 0U; l < I2C_TIMINGR_SCLDEL_MAX; l++) {
-      // tSCLDEL = (SCLDEL + 1U) * ((PRESC + 1U) * tI2CCLK)
-      scldel = (l + 1U) * presc;
-
-      if (scldel >= scldel_min) {
-        // SCLDEL is above low limit, evaluate SDADEL
-        for (a = 0U; a < I2C_TIMINGR_SDADEL_MAX; a++) {
-          // tSDADEL = SDADEL * ((PRESC + 1U) * tI2CCLK)
-          sdadel = a * presc;
-
-          if ((sdadel >= sdadel_min) && (sdadel <= sdadel_max)) {
-            // Valid presc (p), scldel (l) and sdadel (a)
-            timing_reg.presc  = (uint8_t)p;
-            timing_reg.scldel = (uint8_t)l;
-            timing_reg.sdadel = (uint8_t)a;
-
-            // Determine SCLL and SCLH values
-            err = I2Cn_GetSCLRatio(ptr_clock_setup, ptr_timing_spec, &timing_reg);
-
-            if (err >= 0) {
-              if (err < ptr_clock_setup->error) {
-                // Truncate error since it will never be bigger than 16-bit
-                ptr_clock_setup->error = (uint16_t)err;
-
-                // Save timing settings
-                timing  = (timing_reg.scll   & 0xFFU);
-                timing |= (timing_reg.sclh   & 0xFFU) <<  8;
-                timing |= (timing_reg.sdadel & 0x0FU) << 16;
-                timing |= (timing_reg.scldel & 0x0FU) << 20;
-                timing |= (timing_reg.presc  & 0x0FU) << 28;
-              }
-            }
-          }
+    // Smallest SCLDEL: tSCLDEL = (SCLDEL + 1U) * ((PRESC + 1U) * tI2CCLK) >= SCLDEL (min)
+    l = I2Cn_GetMinCount(scldel_min, 0U, presc);
+
+    // Smallest SDADEL: tSDADEL = SDADEL * ((PRESC + 1U) * tI2CCLK) >= SDADEL (min)
+    a = (sdadel_min + presc - 1U) / presc;
+
+    if ((l >= I2C_TIMINGR_SCLDEL_MAX) || (a >= I2C_TIMINGR_SDADEL_MAX) || ((a * presc) > sdadel_max)) {
+      // No valid SCLDEL or SDADEL for this PRESC
+      continue;
+    }
+
+    // Valid presc (p), scldel (l) and sdadel (a)
+    timing_reg.presc  = (uint8_t)p;
+    timing_reg.scldel = (uint8_t)l;
+    timing_reg.sdadel = (uint8_t)a;
+
+    // Determine SCLL and SCLH values
+    err = I2Cn_GetSCLRatio(ptr_clock_setup, ptr_timing_spec, &timing_reg);
+
+    if (err >= 0) {
+      if ((uint32_t)err < ptr_clock_setup->error) {
+        ptr_clock_setup->error = (uint32_t)err;
+
+        // Save timing settings
+        timing  = (timing_reg.scll   & 0xFFU);
+        timing |= (timing_reg.sclh   & 0xFFU) <<  8;
+        timing |= (timing_reg.sdadel & 0x0FU) << 16;
+        timing |= (timing_reg.scldel & 0x0FU) << 20;
+        timing |= (timing_reg.presc  & 0x0FU) << 28;
+
+        if (err == 0) {
+          // Exact bus clock period, larger PRESC values cannot give a better result
+          break;
         }
       }
     }
@@ -808,6 +1242,133 @@ static uint32_t I2Cn_GetTimingValue (ClockSetup_t *ptr_clock_setup, const Standa
 
   return timing;
 }
+
+/**
+  \fn          uint32_t I2Cn_CalcTiming (const RO_Info_t * const ptr_ro_info, uint32_t periph_clk, const StandardTiming_t *ptr_timing_spec, uint32_t scl_freq, uint32_t dnf)
+  \brief       Calculate TIMINGR register value for requested SCL frequency.
+  \param[in]   ptr_ro_info      Pointer to I2C RO info structure (RO_Info_t)
+  \param[in]   periph_clk       Peripheral clock frequency (in Hz)
+  \param[in]   ptr_timing_spec  Pointer to I2C timing specification of the speed class
+  \param[in]   scl_freq         Requested SCL frequency (in Hz)
+  \param[in]   dnf              Digital noise filter coefficient value (0 - disabled)
+  \return      TIMINGR register value, or 0 if no valid setting exists
+*/
+static uint32_t I2Cn_CalcTiming (const RO_Info_t * const ptr_ro_info, uint32_t periph_clk, const StandardTiming_t *ptr_timing_spec, uint32_t scl_freq, uint32_t dnf) {
+  ClockSetup_t clock_setup;
+  uint32_t     timing;
+
+  // Determine peripheral and bus clock period (in ns)
+  clock_setup.i2cclk = (1000000000U + (periph_clk / 2)) / periph_clk;
+  clock_setup.busclk = (1000000000U + (scl_freq   / 2)) / scl_freq;
+
+  // Determine digital filter delay (in ns)
+  clock_setup.dfd = clock_setup.i2cclk * dnf;
+
+  // Set analog filter delay (in ns)
+  if (ptr_ro_info->anf_en != 0U) {
+    clock_setup.afd_min = I2C_ANALOG_FILTER_DELAY_MIN;
+    clock_setup.afd_max = I2C_ANALOG_FILTER_DELAY_MAX;
+  } else {
+    clock_setup.afd_min = 0U;
+    clock_setup.afd_max = 0U;
+  }
+
+  // Set max iteration error
+  clock_setup.error = 0xFFFFFFFFU;
+
+  // Get TIMINGR register values
+  timing = I2Cn_GetTimingValue(&clock_setup, ptr_timing_spec);
+
+  if (clock_setup.error == 0xFFFFFFFFU) {
+    // No valid setting for this peripheral clock
+    timing = 0U;
+  }
+
+  return timing;
+}
+
+/**
+  \fn          uint32_t I2Cn_GetTiming (const RO_Info_t * const ptr_ro_info, uint32_t periph_clk, uint32_t bus_speed)
+  \brief       Get TIMINGR register value for standard bus speed.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \param[in]   periph_clk    Peripheral clock frequency (in Hz)
+  \param[in]   bus_speed     Bus speed: ARM_I2C_BUS_SPEED_STANDARD, ARM_I2C_BUS_SPEED_FAST or ARM_I2C_BUS_SPEED_FAST_PLUS
+  \return      TIMINGR register value, or 0 if no valid setting exists
+*/
+static uint32_t I2Cn_GetTiming (const RO_Info_t * const ptr_ro_info, uint32_t periph_clk, uint32_t bus_speed) {
+  uint32_t idx, timing, dnf;
+
+  idx = bus_speed - ARM_I2C_BUS_SPEED_STANDARD;
+  dnf = (ptr_ro_info->ptr_rw_info->cr1 & I2C_CR1_DNF) >> I2C_CR1_DNF_Pos;
+
+  if (ptr_ro_info->ptr_rw_info->timingr_clk != periph_clk) {
+    // If peripheral clock has changed, discard TIMINGR values determined at run-time
+    memset((void *)ptr_ro_info->ptr_rw_info->timingr, 0, sizeof(ptr_ro_info->ptr_rw_info->timingr));
+    ptr_ro_info->ptr_rw_info->timingr_clk = periph_clk;
+  }
+
+  timing = ptr_ro_info->ptr_rw_info->timingr[idx];
+  if (timing != 0U) {
+    // TIMINGR value was already determined
+    return timing;
+  }
+
+  if ((periph_clk == ptr_ro_info->peri_clock_freq) && (dnf == ptr_ro_info->dnf)) {
+    // If clock and digital filter are as configured at build-time, use build-time TIMINGR value (if it exists)
+    timing = ptr_ro_info->timingr[idx];
+  }
+
+  if (timing == 0U) {
+    // Determine TIMINGR value at run-time
+    switch (bus_speed) {
+      case ARM_I2C_BUS_SPEED_STANDARD:          // Standard Speed (100kHz)
+        timing = I2Cn_CalcTiming(ptr_ro_info, periph_clk, &i2c_spec_standard,  100000U, dnf);
+        break;
+
+      case ARM_I2C_BUS_SPEED_FAST:              // Fast Speed (400kHz)
+        timing = I2Cn_CalcTiming(ptr_ro_info, periph_clk, &i2c_spec_fast,      400000U, dnf);
+        break;
+
+      case ARM_I2C_BUS_SPEED_FAST_PLUS:         // Fast+ Speed (1MHz)
+      default:
+        timing = I2Cn_CalcTiming(ptr_ro_info, periph_clk, &i2c_spec_fast_plus, 1000000U, dnf);
+        break;
+    }
+  }
+
+  // Keep TIMINGR value for subsequent bus speed changes
+  ptr_ro_info->ptr_rw_info->timingr[idx] = timing;
+
+  return timing;
+}
+
+/**
+  \fn          uint32_t I2Cn_GetTimingFreq (const RO_Info_t * const ptr_ro_info, uint32_t periph_clk, uint32_t scl_freq)
+  \brief       Get TIMINGR register value for arbitrary SCL frequency.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \param[in]   periph_clk    Peripheral clock frequency (in Hz)
+  \param[in]   scl_freq      Requested SCL frequency (in Hz)
+  \param[in]   dnf           Digital noise filter coefficient value (0 - disabled)
+  \return      TIMINGR register value, or 0 if no valid setting exists
+*/
+static uint32_t I2Cn_GetTimingFreq (const RO_Info_t * const ptr_ro_info, uint32_t periph_clk, uint32_t scl_freq, uint32_t dnf) {
+  StandardTiming_t timing_spec;
+
+  // Use timing specification (SCL low/high periods, rise/fall times, data setup/hold times)
+  // of the lowest speed class that includes the requested frequency
+  if (scl_freq <= i2c_spec_standard.clk_max) {
+    timing_spec = i2c_spec_standard;
+  } else if (scl_freq <= i2c_spec_fast.clk_max) {
+    timing_spec = i2c_spec_fast;
+  } else {
+    timing_spec = i2c_spec_fast_plus;
+  }
+
+  // Requested frequency is the max SCL frequency
+  timing_spec.clk_max = scl_freq;
+
+  return I2Cn_CalcTiming(ptr_ro_info, periph_clk, &timing_spec, scl_freq, dnf);
+}
 #endif
 
 // Driver functions ************************************************************
@@ -842,6 +1403,11 @@ static int32_t I2Cn_Initialize (const RO_Info_t * const ptr_ro_info, ARM_I2C_Sig
   // Clear run-time info
   memset((void *)ptr_ro_info->ptr_rw_info, 0, sizeof(RW_Info_t));
 
+#ifdef  I2C_VARIANT_TIMINGR             // If this is variant with TIMINGR register
+  // TIMINGR value matching the build-time digital filter setting
+  ptr_ro_info->ptr_rw_info->timing_mx = ptr_ro_info->ptr_hi2c->Init.Timing;
+#endif
+
   // Register callback function
   ptr_ro_info->ptr_rw_info->cb_event = cb_event;
 
@@ -864,6 +1430,13 @@ static int32_t I2Cn_Uninitialize (const RO_Info_t * const ptr_ro_info) {
     (void)I2Cn_PowerControl(ptr_ro_info, ARM_POWER_OFF);
   }
 
+#ifdef  I2C_VARIANT_TIMINGR             // If this is variant with TIMINGR register
+  // Restore build-time TIMINGR value for next initialization
+  if (ptr_ro_info->ptr_rw_info->drv_status.initialized != 0U) {
+    ptr_ro_info->ptr_hi2c->Init.Timing = ptr_ro_info->ptr_rw_info->timing_mx;
+  }
+#endif
+
   // Clear run-time info
   memset((void *)ptr_ro_info->ptr_rw_info, 0, sizeof(RW_Info_t));
 
@@ -880,6 +1453,9 @@ static int32_t I2Cn_Uninitialize (const RO_Info_t * const ptr_ro_info) {
 static int32_t I2Cn_PowerControl (const RO_Info_t * const ptr_ro_info, ARM_POWER_STATE state) {
   ARM_I2C_SignalEvent_t cb_event;
   DriverStatus_t        drv_status;
+#ifdef  I2C_VARIANT_TIMINGR
+  uint32_t              timing_mx;
+#endif
 
   switch (state) {
     case ARM_POWER_FULL:
@@ -887,9 +1463,15 @@ static int32_t I2Cn_PowerControl (const RO_Info_t * const ptr_ro_info, ARM_POWER
         return ARM_DRIVER_ERROR;
       }
 
+      // Complete queued transfers
+      I2Cn_QueueFlush(ptr_ro_info);
+
       // Store variables we need to preserve
       cb_event   = ptr_ro_info->ptr_rw_info->cb_event;
       drv_status = ptr_ro_info->ptr_rw_info->drv_status;
+#ifdef  I2C_VARIANT_TIMINGR
+      timing_mx  = ptr_ro_info->ptr_rw_info->timing_mx;
+#endif
 
       // Clear run-time info
       memset((void *)ptr_ro_info->ptr_rw_info, 0, sizeof(RW_Info_t));
@@ -897,28 +1479,30 @@ static int32_t I2Cn_PowerControl (const RO_Info_t * const ptr_ro_info, ARM_POWER
       // Restore variables we wanted to preserve
       ptr_ro_info->ptr_rw_info->cb_event   = cb_event;
       ptr_ro_info->ptr_rw_info->drv_status = drv_status;
+#ifdef  I2C_VARIANT_TIMINGR
+      ptr_ro_info->ptr_rw_info->timing_mx  = timing_mx;
+#endif
 
-      // Initialize pins, clocks, interrupts and peripheral
-      if (HAL_I2C_Init(ptr_ro_info->ptr_hi2c) != HAL_OK) {
-        return ARM_DRIVER_ERROR;
+#ifdef  I2C_VARIANT_TIMINGR             // If this is variant with TIMINGR register
+      // Filters as configured at build-time, SMBus disabled
+      ptr_ro_info->ptr_rw_info->cr1 = (ptr_ro_info->dnf << I2C_CR1_DNF_Pos) & I2C_CR1_DNF;
+      if (ptr_ro_info->anf_en == 0U) {
+        ptr_ro_info->ptr_rw_info->cr1 |= I2C_CR1_ANFOFF;
       }
 
-#ifdef I2C_VARIANT_HAS_FILTER           // If I2C peripheral has filters
-      // Reconfigure Analog Noise Filter because HAL_I2C_Init destroys ANFOFF setting in the CR1 register
-      if (ptr_ro_info->anf_en != 0U) {
-        if (HAL_I2CEx_ConfigAnalogFilter(ptr_ro_info->ptr_hi2c, I2C_ANALOGFILTER_ENABLE) != HAL_OK) {
-          return ARM_DRIVER_ERROR;
-        }
-      } else {
-        if (HAL_I2CEx_ConfigAnalogFilter(ptr_ro_info->ptr_hi2c, I2C_ANALOGFILTER_DISABLE) != HAL_OK) {
-          return ARM_DRIVER_ERROR;
-        }
-      }
+      // TIMINGR set at run-time might be for a different digital filter (I2C_STM32_SET_MAX_DNF),
+      // so restore build-time value together with the build-time filters
+      ptr_ro_info->ptr_hi2c->Init.Timing = timing_mx;
+#endif
 
-      // Reconfigure Digital Noise Filter because HAL_I2C_Init destroys DNF setting in the CR1 register
-      if (HAL_I2CEx_ConfigDigitalFilter(ptr_ro_info->ptr_hi2c, ptr_ro_info->dnf) != HAL_OK) {
+      // Initialize pins, clocks, interrupts and peripheral
+      if (I2Cn_PeriphInit(ptr_ro_info) != ARM_DRIVER_OK) {
         return ARM_DRIVER_ERROR;
       }
+
+#ifdef  I2C_VARIANT_TIMINGR             // If this is variant with TIMINGR register
+      // Disable SMBus timeouts (HAL_I2C_Init does not change the TIMEOUTR register)
+      ptr_ro_info->ptr_hi2c->Instance->TIMEOUTR = 0U;
 #endif
 
       // Set driver status to powered
@@ -938,6 +1522,9 @@ static int32_t I2Cn_PowerControl (const RO_Info_t * const ptr_ro_info, ARM_POWER
       // Set driver status to not powered
       ptr_ro_info->ptr_rw_info->drv_status.powered = 0U;
 
+      // Complete queued transfers
+      I2Cn_QueueFlush(ptr_ro_info);
+
       // Store variables we need to preserve
       cb_event   = ptr_ro_info->ptr_rw_info->cb_event;
       drv_status = ptr_ro_info->ptr_rw_info->drv_status;
@@ -976,7 +1563,7 @@ static int32_t I2Cn_MasterTransmit (const RO_Info_t * const ptr_ro_info, uint32_
   uint32_t          opt;
   int32_t           ret;
 
-  if ((data == NULL) || (num == 0U) || (num > (uint32_t)UINT16_MAX) ||
+  if ((data == NULL) || (num == 0U) ||
      ((addr & ~((uint32_t)ARM_I2C_ADDRESS_10BIT | (uint32_t)ARM_I2C_ADDRESS_GC)) > 0x3FFU)) {
     // If any parameter is invalid
     return ARM_DRIVER_ERROR_PARAMETER;
@@ -995,16 +1582,9 @@ static int32_t I2Cn_MasterTransmit (const RO_Info_t * const ptr_ro_info, uint32_
     saddr <<= 1;
   }
 
-  ptr_ro_info->ptr_rw_info->i2c_direction        = 0U;
-  ptr_ro_info->ptr_rw_info->i2c_bus_error        = 0U;
-  ptr_ro_info->ptr_rw_info->i2c_arbitration_lost = 0U;
-
-  ptr_ro_info->ptr_rw_info->xfer_size            = num;
-
   if (xfer_pending == true) {           // If transfer should not generate STOP at the end
     if (ptr_ro_info->ptr_rw_info->xfer_no_stop == 0U) {
       // First transfer without STOP generation
-      ptr_ro_info->ptr_rw_info->xfer_no_stop = 1U;
       opt = I2C_FIRST_FRAME;
     } else {
       // Any further transfer without STOP generation
@@ -1013,7 +1593,6 @@ static int32_t I2Cn_MasterTransmit (const RO_Info_t * const ptr_ro_info, uint32_
   } else {                              // If transfer should generate STOP at the end
     if (ptr_ro_info->ptr_rw_info->xfer_no_stop == 1U) {
       // If previous request did not generate STOP after transfer, terminate the sequence
-      ptr_ro_info->ptr_rw_info->xfer_no_stop = 0U;
       opt = I2C_OTHER_AND_LAST_FRAME;
     } else {
       opt = I2C_LAST_FRAME;
@@ -1021,10 +1600,11 @@ static int32_t I2Cn_MasterTransmit (const RO_Info_t * const ptr_ro_info, uint32_
   }
 
   // Start the transmit
-  if (ptr_ro_info->ptr_hi2c->hdmatx != NULL) {  // If DMA is used for Tx
-    tx_status = HAL_I2C_Master_Seq_Transmit_DMA(ptr_ro_info->ptr_hi2c, saddr, (uint8_t *)(uint32_t)data, (uint16_t)num, opt);
-  } else {                                      // If DMA is not configured (IRQ mode)
-    tx_status = HAL_I2C_Master_Seq_Transmit_IT (ptr_ro_info->ptr_hi2c, saddr, (uint8_t *)(uint32_t)data, (uint16_t)num, opt);
+  tx_status = I2Cn_XferStart(ptr_ro_info, I2C_XFER_MASTER_TX, saddr, (uint8_t *)(uint32_t)data, num, opt);
+
+  if (tx_status == HAL_OK) {
+    // Sequence state changes only when transfer was started
+    ptr_ro_info->ptr_rw_info->xfer_no_stop = (xfer_pending == true) ? 1U : 0U;
   }
 
   // Convert HAL status code to CMSIS-Driver status code
@@ -1066,7 +1646,7 @@ static int32_t I2Cn_MasterReceive (const RO_Info_t * const ptr_ro_info, uint32_t
   uint32_t          opt;
   int32_t           ret;
 
-  if ((data == NULL) || (num == 0U) || (num > (uint32_t)UINT16_MAX) ||
+  if ((data == NULL) || (num == 0U) ||
      ((addr & ~((uint32_t)ARM_I2C_ADDRESS_10BIT | (uint32_t)ARM_I2C_ADDRESS_GC)) > 0x3FFU)) {
     // If any parameter is invalid
     return ARM_DRIVER_ERROR_PARAMETER;
@@ -1085,16 +1665,9 @@ static int32_t I2Cn_MasterReceive (const RO_Info_t * const ptr_ro_info, uint32_t
     saddr <<= 1;
   }
 
-  ptr_ro_info->ptr_rw_info->i2c_direction        = 1U;
-  ptr_ro_info->ptr_rw_info->i2c_bus_error        = 0U;
-  ptr_ro_info->ptr_rw_info->i2c_arbitration_lost = 0U;
-
-  ptr_ro_info->ptr_rw_info->xfer_size            = num;
-
   if (xfer_pending == true) {           // If transfer should not generate STOP at the end
     if (ptr_ro_info->ptr_rw_info->xfer_no_stop == 0U) {
       // First transfer without STOP generation
-      ptr_ro_info->ptr_rw_info->xfer_no_stop = 1U;
       opt = I2C_FIRST_FRAME;
     } else {
       // Any further transfer without STOP generation
@@ -1103,7 +1676,6 @@ static int32_t I2Cn_MasterReceive (const RO_Info_t * const ptr_ro_info, uint32_t
   } else {                              // If transfer should generate STOP at the end
     if (ptr_ro_info->ptr_rw_info->xfer_no_stop == 1U) {
       // If previous request did not generate STOP after transfer, terminate the sequence
-      ptr_ro_info->ptr_rw_info->xfer_no_stop = 0U;
       opt = I2C_OTHER_AND_LAST_FRAME;
     } else {
       opt = I2C_LAST_FRAME;
@@ -1111,10 +1683,11 @@ static int32_t I2Cn_MasterReceive (const RO_Info_t * const ptr_ro_info, uint32_t
   }
 
   // Start the reception
-  if (ptr_ro_info->ptr_hi2c->hdmarx != NULL) {  // If DMA is used for Rx
-    rx_status = HAL_I2C_Master_Seq_Receive_DMA(ptr_ro_info->ptr_hi2c, saddr, data, (uint16_t)num, opt);
-  } else {                                      // If DMA is not configured (IRQ mode)
-    rx_status = HAL_I2C_Master_Seq_Receive_IT (ptr_ro_info->ptr_hi2c, saddr, data, (uint16_t)num, opt);
+  rx_status = I2Cn_XferStart(ptr_ro_info, I2C_XFER_MASTER_RX, saddr, data, num, opt);
+
+  if (rx_status == HAL_OK) {
+    // Sequence state changes only when transfer was started
+    ptr_ro_info->ptr_rw_info->xfer_no_stop = (xfer_pending == true) ? 1U : 0U;
   }
 
   // Convert HAL status code to CMSIS-Driver status code
@@ -1141,16 +1714,22 @@ static int32_t I2Cn_MasterReceive (const RO_Info_t * const ptr_ro_info, uint32_t
 }
 
 /**
-  \fn          int32_t I2Cn_SlaveTransmit (const RO_Info_t * const ptr_ro_info, const uint8_t *data, uint32_t num)
-  \brief       Start transmitting data as I2C Slave.
+  \fn          int32_t I2Cn_MasterTransmitReceive (const RO_Info_t * const ptr_ro_info, const I2C_STM32_MASTER_XFER *xfer)
+  \brief       Start transmitting data followed by receiving data with repeated START as I2C Master.
   \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
-  \param[in]   data          Pointer to buffer with data to transmit to I2C Master
-  \param[in]   num           Number of data bytes to transmit
+  \param[in]   xfer          Pointer to transfer description (I2C_STM32_MASTER_XFER)
   \return      \ref execution_status
 */
-static int32_t I2Cn_SlaveTransmit (const RO_Info_t * const ptr_ro_info, const uint8_t *data, uint32_t num) {
+static int32_t I2Cn_MasterTransmitReceive (const RO_Info_t * const ptr_ro_info, const I2C_STM32_MASTER_XFER *xfer) {
+  HAL_StatusTypeDef tx_status;
+  uint16_t          saddr;
+  uint32_t          opt;
+  uint32_t          irq_en;
 
-  if ((data == NULL) || (num == 0U) || (num > (uint32_t)UINT16_MAX)) {
+  if ((xfer == NULL) ||
+      (xfer->tx_data == NULL) || (xfer->tx_num == 0U) ||
+      (xfer->rx_data == NULL) || (xfer->rx_num == 0U) ||
+     ((xfer->addr & ~((uint32_t)ARM_I2C_ADDRESS_10BIT | (uint32_t)ARM_I2C_ADDRESS_GC)) > 0x3FFU)) {
     // If any parameter is invalid
     return ARM_DRIVER_ERROR_PARAMETER;
   }
@@ -1163,84 +1742,960 @@ static int32_t I2Cn_SlaveTransmit (const RO_Info_t * const ptr_ro_info, const ui
     return ARM_DRIVER_ERROR_BUSY;
   }
 
-  if (HAL_I2C_GetState(ptr_ro_info->ptr_hi2c) != HAL_I2C_STATE_LISTEN) {
-    return ARM_DRIVER_ERROR;
+  saddr = (xfer->addr & 0x3FFU);
+  if (ptr_ro_info->ptr_hi2c->Init.AddressingMode == I2C_ADDRESSINGMODE_7BIT) {
+    saddr <<= 1;
   }
 
-  ptr_ro_info->ptr_rw_info->i2c_bus_error       = 0U;
-  ptr_ro_info->ptr_rw_info->i2c_general_call    = 0U;
+  if (ptr_ro_info->ptr_rw_info->xfer_no_stop == 0U) {
+    // Transmit is the first frame of the sequence
+    opt = I2C_FIRST_FRAME;
+  } else {
+    // Transmit continues the sequence started by previous request without STOP generation
+    opt = I2C_OTHER_FRAME;
+  }
 
-  ptr_ro_info->ptr_rw_info->xfer_size           = 0U;
+  // Transmit completion must not be serviced before receive parameters are registered
+  irq_en = I2Cn_IrqDisable(ptr_ro_info);
 
-  // Just register transmit parameters, actual operation will be started from HAL_I2C_AddrCallback
-  ptr_ro_info->ptr_rw_info->slave_xfer_tx_data  = data;
-  ptr_ro_info->ptr_rw_info->slave_xfer_tx_num   = (uint16_t)num;
+  // Start the transmit
+  tx_status = I2Cn_XferStart(ptr_ro_info, I2C_XFER_MASTER_TX, saddr, (uint8_t *)(uint32_t)xfer->tx_data, xfer->tx_num, opt);
+
+  if (tx_status == HAL_OK) {
+    // Register receive parameters, reception will be started from HAL_I2C_MasterTxCpltCallback
+    ptr_ro_info->ptr_rw_info->master_xfer_rx_data  = xfer->rx_data;
+    ptr_ro_info->ptr_rw_info->master_xfer_rx_num   = xfer->rx_num;
+    ptr_ro_info->ptr_rw_info->xfer_no_stop         = 1U;
+  }
+
+  I2Cn_IrqRestore(ptr_ro_info, irq_en);
+
+  if (tx_status != HAL_OK) {
+    if (tx_status == HAL_BUSY) {
+      return ARM_DRIVER_ERROR_BUSY;
+    }
+    return ARM_DRIVER_ERROR;
+  }
 
   return ARM_DRIVER_OK;
 }
 
 /**
-  \fn          int32_t I2Cn_SlaveReceive (const RO_Info_t * const ptr_ro_info, uint8_t *data, uint32_t num)
-  \brief       Start receiving data as I2C Slave.
+  \fn          int32_t I2Cn_QueueTransfer (const RO_Info_t * const ptr_ro_info, I2C_STM32_QUEUE_XFER *qxfer)
+  \brief       Queue Master transfer, transfer is started immediately if no other transfer is in progress.
   \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
-  \param[out]  data          Pointer to buffer for data to receive from I2C Master
-  \param[in]   num           Number of data bytes to receive
+  \param[in]   qxfer         Pointer to queued transfer (I2C_STM32_QUEUE_XFER)
   \return      \ref execution_status
 */
-static int32_t I2Cn_SlaveReceive (const RO_Info_t * const ptr_ro_info, uint8_t *data, uint32_t num) {
-
-  if ((data == NULL) || (num == 0U) || (num > (uint32_t)UINT16_MAX)) {
+static int32_t I2Cn_QueueTransfer (const RO_Info_t * const ptr_ro_info, I2C_STM32_QUEUE_XFER *qxfer) {
+  I2C_STM32_QUEUE_XFER **ptr_link;
+  uint32_t               primask;
+
+  if ((qxfer == NULL) ||
+     ((qxfer->xfer.tx_num == 0U) && (qxfer->xfer.rx_num == 0U)) ||
+     ((qxfer->xfer.tx_num != 0U) && (qxfer->xfer.tx_data == NULL)) ||
+     ((qxfer->xfer.rx_num != 0U) && (qxfer->xfer.rx_data == NULL)) ||
+     ((qxfer->xfer.addr & ~((uint32_t)ARM_I2C_ADDRESS_10BIT | (uint32_t)ARM_I2C_ADDRESS_GC)) > 0x3FFU)) {
     // If any parameter is invalid
     return ARM_DRIVER_ERROR_PARAMETER;
   }
 
-  if (ptr_ro_info->ptr_rw_info->drv_status.powered == 0U) {
-    return ARM_DRIVER_ERROR;
-  }
+  qxfer->event = 0U;
 
-  if (I2Cn_GetStatus(ptr_ro_info).busy != 0U) {
-    return ARM_DRIVER_ERROR_BUSY;
-  }
+  primask = __get_PRIMASK();
+  __disable_irq();
 
-  ptr_ro_info->ptr_rw_info->i2c_bus_error       = 0U;
-  ptr_ro_info->ptr_rw_info->i2c_general_call    = 0U;
+  // Insert transfer after all queued transfers with same or higher priority
+  ptr_link = &ptr_ro_info->ptr_rw_info->queue_head;
+  while ((*ptr_link != NULL) && ((*ptr_link)->priority <= qxfer->priority)) {
+    ptr_link = &(*ptr_link)->next;
+  }
+  qxfer->next = *ptr_link;
+  *ptr_link   =  qxfer;
 
-  ptr_ro_info->ptr_rw_info->xfer_size           = 0U;
+  __set_PRIMASK(primask);
 
-  // Just register receive parameters, actual operation will be started from HAL_I2C_AddrCallback
-  ptr_ro_info->ptr_rw_info->slave_xfer_rx_data  = data;
-  ptr_ro_info->ptr_rw_info->slave_xfer_rx_num   = (uint16_t)num;
+  // Start the transfer if no other transfer is in progress
+  I2Cn_QueueStartNext(ptr_ro_info);
 
   return ARM_DRIVER_OK;
 }
 
 /**
-  \fn          int32_t I2Cn_GetDataCount (const RO_Info_t * const ptr_ro_info)
-  \brief       Get transferred data count.
+  \fn          void I2Cn_QueueStartNext (const RO_Info_t * const ptr_ro_info)
+  \brief       Start next queued Master transfer if no transfer is in progress.
   \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
-  \return      number of data bytes transferred; -1 when Slave is not addressed by Master
 */
-static int32_t I2Cn_GetDataCount (const RO_Info_t * const ptr_ro_info) {
-  int32_t cnt;
-  int32_t cnt_xferred;
-  uint8_t cnt_xferred_valid;
+static void I2Cn_QueueStartNext (const RO_Info_t * const ptr_ro_info) {
+  I2C_STM32_QUEUE_XFER  *qxfer;
+  I2C_STM32_QUEUE_XFER **ptr_link;
+  int32_t                status;
+  uint32_t               primask;
+  uint32_t               irq_en;
+
+  do {
+    // Completion interrupts of this instance must not be serviced while next transfer is being started
+    irq_en = I2Cn_IrqDisable(ptr_ro_info);
+
+    qxfer = NULL;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    // Queued transfer is not started while any transfer is in progress or
+    // while sequence of transfers without STOP (xfer_pending) is open
+    if ((ptr_ro_info->ptr_rw_info->queue_active == NULL) &&
+        (ptr_ro_info->ptr_rw_info->queue_head   != NULL) &&
+        (ptr_ro_info->ptr_rw_info->xfer_no_stop == 0U)   &&
+        (I2Cn_GetStatus(ptr_ro_info).busy       == 0U)) {
+      qxfer = ptr_ro_info->ptr_rw_info->queue_head;
+      ptr_ro_info->ptr_rw_info->queue_head   = qxfer->next;
+      ptr_ro_info->ptr_rw_info->queue_active = qxfer;
+    }
 
-  if (ptr_ro_info->ptr_rw_info->drv_status.powered == 0U) {
-    return 0;
-  }
+    __set_PRIMASK(primask);
 
-  if (HAL_I2C_GetState(ptr_ro_info->ptr_hi2c) == HAL_I2C_STATE_LISTEN) {
-    cnt = -1;
-  } else {
-    cnt_xferred       = 0;
-    cnt_xferred_valid = 0U;
-    if (ptr_ro_info->ptr_hi2c->hdmarx != NULL) {        // If DMA is used for Rx
-      if (ptr_ro_info->ptr_hi2c->hdmarx->State == HAL_DMA_STATE_BUSY) {
-        // If reception is in progress
-        cnt_xferred       = (int32_t)__HAL_DMA_GET_COUNTER(ptr_ro_info->ptr_hi2c->hdmarx);
-        cnt_xferred_valid = 1U;
+    if (qxfer != NULL) {
+      // Transfer is started with other interrupts enabled as HAL might wait for the bus to become free
+      if ((qxfer->xfer.tx_num != 0U) && (qxfer->xfer.rx_num != 0U)) {
+        status = I2Cn_MasterTransmitReceive(ptr_ro_info, &qxfer->xfer);
+      } else if (qxfer->xfer.tx_num != 0U) {
+        status = I2Cn_MasterTransmit(ptr_ro_info, qxfer->xfer.addr, qxfer->xfer.tx_data, qxfer->xfer.tx_num, false);
+      } else {
+        status = I2Cn_MasterReceive (ptr_ro_info, qxfer->xfer.addr, qxfer->xfer.rx_data, qxfer->xfer.rx_num, false);
       }
-    }
+
+      if (status == ARM_DRIVER_OK) {
+        qxfer = NULL;
+      } else {
+        primask = __get_PRIMASK();
+        __disable_irq();
+
+        ptr_ro_info->ptr_rw_info->queue_active = NULL;
+
+        if (status == ARM_DRIVER_ERROR_BUSY) {
+          // Peripheral is busy (used as Slave), return transfer to the queue ahead of transfers with same priority,
+          // it is started when current transfer completes
+          ptr_link = &ptr_ro_info->ptr_rw_info->queue_head;
+          while ((*ptr_link != NULL) && ((*ptr_link)->priority < qxfer->priority)) {
+            ptr_link = &(*ptr_link)->next;
+          }
+          qxfer->next = *ptr_link;
+          *ptr_link   =  qxfer;
+          qxfer       =  NULL;
+        } else {
+          // Transfer could not be started, it is completed below
+          qxfer->event = ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_TRANSFER_INCOMPLETE;
+        }
+
+        __set_PRIMASK(primask);
+      }
+    }
+
+    I2Cn_IrqRestore(ptr_ro_info, irq_en);
+
+    if ((qxfer != NULL) && (qxfer->cb_xfer != NULL)) {
+      // Complete transfer that could not be started (with interrupts enabled) and try the next one
+      qxfer->cb_xfer(qxfer, qxfer->event);
+    }
+  } while (qxfer != NULL);
+}
+
+/**
+  \fn          uint32_t I2Cn_QueueComplete (const RO_Info_t * const ptr_ro_info, uint32_t event)
+  \brief       Complete queued Master transfer in progress.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \param[in]   event         Transfer completion events
+  \return      1 if queued transfer was in progress, 0 otherwise
+*/
+static uint32_t I2Cn_QueueComplete (const RO_Info_t * const ptr_ro_info, uint32_t event) {
+  I2C_STM32_QUEUE_XFER *qxfer;
+
+  qxfer = ptr_ro_info->ptr_rw_info->queue_active;
+  if (qxfer == NULL) {
+    return 0U;
+  }
+  ptr_ro_info->ptr_rw_info->queue_active = NULL;
+
+  qxfer->event = event;
+  if (qxfer->cb_xfer != NULL) {
+    qxfer->cb_xfer(qxfer, event);
+  }
+
+  return 1U;
+}
+
+/**
+  \fn          void I2Cn_QueueFlush (const RO_Info_t * const ptr_ro_info)
+  \brief       Complete all queued Master transfers as incomplete.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+*/
+static void I2Cn_QueueFlush (const RO_Info_t * const ptr_ro_info) {
+  I2C_STM32_QUEUE_XFER *qxfer;
+  uint32_t              event;
+
+  event = ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_TRANSFER_INCOMPLETE;
+
+  (void)I2Cn_QueueComplete(ptr_ro_info, event);
+
+  while (ptr_ro_info->ptr_rw_info->queue_head != NULL) {
+    qxfer = ptr_ro_info->ptr_rw_info->queue_head;
+    ptr_ro_info->ptr_rw_info->queue_head = qxfer->next;
+
+    qxfer->event = event;
+    if (qxfer->cb_xfer != NULL) {
+      qxfer->cb_xfer(qxfer, event);
+    }
+  }
+}
+
+/**
+  \fn          HAL_StatusTypeDef I2Cn_XferChunk (const RO_Info_t * const ptr_ro_info, uint32_t xfer_type, uint16_t saddr, uint8_t *data, uint32_t num, uint32_t opt)
+  \brief       Request transfer of one chunk of data from HAL.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \param[in]   xfer_type     Transfer type (I2C_XFER_xxx)
+  \param[in]   saddr         Slave address in HAL format (Master transfers only)
+  \param[in]   data          Pointer to chunk data
+  \param[in]   num           Number of bytes in chunk (up to I2C_XFER_CHUNK_MAX)
+  \param[in]   opt           HAL transfer option
+  \return      HAL status
+*/
+static HAL_StatusTypeDef I2Cn_XferChunk (const RO_Info_t * const ptr_ro_info, uint32_t xfer_type, uint16_t saddr, uint8_t *data, uint32_t num, uint32_t opt) {
+  HAL_StatusTypeDef status;
+  I2C_HandleTypeDef *hi2c;
+
+  hi2c  = ptr_ro_info->ptr_hi2c;
+
+#ifdef  I2C_VARIANT_TIMINGR             // If this is variant with TIMINGR register
+  if (((ptr_ro_info->ptr_rw_info->cr1 & I2C_CR1_PECEN) != 0U)                       &&
+      ((xfer_type == I2C_XFER_MASTER_TX) || (xfer_type == I2C_XFER_MASTER_RX))             &&
+      ((opt == I2C_LAST_FRAME) || (opt == I2C_OTHER_AND_LAST_FRAME))) {
+    // Last byte of Master transfer ending with STOP is PEC byte (transmitted or checked by hardware)
+    hi2c->Instance->CR2 |= I2C_CR2_PECBYTE;
+  }
+#endif
+
+  switch (xfer_type) {
+    case I2C_XFER_MASTER_TX:
+      if (hi2c->hdmatx != NULL) {               // If DMA is used for Tx
+        status = HAL_I2C_Master_Seq_Transmit_DMA(hi2c, saddr, data, (uint16_t)num, opt);
+      } else {                                  // If DMA is not configured (IRQ mode)
+        status = HAL_I2C_Master_Seq_Transmit_IT (hi2c, saddr, data, (uint16_t)num, opt);
+      }
+      break;
+
+    case I2C_XFER_MASTER_RX:
+      if (hi2c->hdmarx != NULL) {               // If DMA is used for Rx
+        status = HAL_I2C_Master_Seq_Receive_DMA (hi2c, saddr, data, (uint16_t)num, opt);
+      } else {                                  // If DMA is not configured (IRQ mode)
+        status = HAL_I2C_Master_Seq_Receive_IT  (hi2c, saddr, data, (uint16_t)num, opt);
+      }
+      break;
+
+    case I2C_XFER_SLAVE_TX:
+      if (hi2c->hdmatx != NULL) {               // If DMA is used for Tx
+        status = HAL_I2C_Slave_Seq_Transmit_DMA (hi2c, data, (uint16_t)num, opt);
+      } else {                                  // If DMA is not configured (IRQ mode)
+        status = HAL_I2C_Slave_Seq_Transmit_IT  (hi2c, data, (uint16_t)num, opt);
+      }
+      break;
+
+    case I2C_XFER_SLAVE_RX:
+      if (hi2c->hdmarx != NULL) {               // If DMA is used for Rx
+        status = HAL_I2C_Slave_Seq_Receive_DMA  (hi2c, data, (uint16_t)num, opt);
+      } else {                                  // If DMA is not configured (IRQ mode)
+        status = HAL_I2C_Slave_Seq_Receive_IT   (hi2c, data, (uint16_t)num, opt);
+      }
+      break;
+
+    default:
+      status = HAL_ERROR;
+      break;
+  }
+
+  return status;
+}
+
+/**
+  \fn          HAL_StatusTypeDef I2Cn_XferStart (const RO_Info_t * const ptr_ro_info, uint32_t xfer_type, uint16_t saddr, uint8_t *data, uint32_t num, uint32_t opt)
+  \brief       Start transfer, transfer larger than I2C_XFER_CHUNK_MAX bytes is split into chunks
+                that are transferred within the same bus transaction.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \param[in]   xfer_type     Transfer type (I2C_XFER_xxx)
+  \param[in]   saddr         Slave address in HAL format (Master transfers only)
+  \param[in]   data          Pointer to data
+  \param[in]   num           Number of bytes to transfer
+  \param[in]   opt           HAL transfer option for whole transfer
+  \return      HAL status
+*/
+static HAL_StatusTypeDef I2Cn_XferStart (const RO_Info_t * const ptr_ro_info, uint32_t xfer_type, uint16_t saddr, uint8_t *data, uint32_t num, uint32_t opt) {
+  RW_Info_t         *ptr_rw_info;
+  HAL_StatusTypeDef  status;
+  uint8_t           *next_data;
+  uint32_t           rem;
+  uint32_t           chunk_opt;
+  uint32_t           last_opt;
+  uint32_t           irq_en;
+
+  ptr_rw_info = ptr_ro_info->ptr_rw_info;
+
+  // Chunk state is prepared locally, state of transfer in progress must not change if HAL rejects the request
+  chunk_opt = opt;
+  last_opt  = opt;
+  next_data = NULL;
+  rem       = 0U;
+  if (num > I2C_XFER_CHUNK_MAX) {
+    rem       = num - I2C_XFER_CHUNK_MAX;
+    next_data = &data[I2C_XFER_CHUNK_MAX];
+    num       = I2C_XFER_CHUNK_MAX;
+
+    if ((xfer_type == I2C_XFER_MASTER_TX) || (xfer_type == I2C_XFER_MASTER_RX)) {
+      // Last chunk ends the transfer as requested, chunks in between continue it without START and STOP
+      if ((opt == I2C_LAST_FRAME) || (opt == I2C_OTHER_AND_LAST_FRAME)) {
+        last_opt = I2C_LAST_FRAME;
+      } else {
+        last_opt = I2C_NEXT_FRAME;
+      }
+
+      // First chunk generates (repeated) START as requested, but not STOP
+      if ((opt == I2C_FIRST_FRAME) || (opt == I2C_LAST_FRAME)) {
+        chunk_opt = I2C_FIRST_FRAME;
+      } else {
+        chunk_opt = I2C_OTHER_FRAME;
+      }
+    }
+  }
+
+  // Chunk completion interrupt must not be serviced before chunk state is committed,
+  // only interrupts of this instance are masked as HAL might wait for the bus to become free
+  irq_en = I2Cn_IrqDisable(ptr_ro_info);
+
+  status = I2Cn_XferChunk(ptr_ro_info, xfer_type, saddr, data, num, chunk_opt);
+
+  if (status == HAL_OK) {
+    ptr_rw_info->xfer_done      = 0U;
+    ptr_rw_info->xfer_size      = num;
+    ptr_rw_info->xfer_rem       = rem;
+    ptr_rw_info->xfer_next_data = next_data;
+    ptr_rw_info->xfer_last_opt  = last_opt;
+
+    if ((xfer_type == I2C_XFER_MASTER_TX) || (xfer_type == I2C_XFER_MASTER_RX)) {
+      ptr_rw_info->master_xfer_saddr    = saddr;
+      ptr_rw_info->i2c_direction        = (xfer_type == I2C_XFER_MASTER_RX) ? 1U : 0U;
+      ptr_rw_info->i2c_bus_error        = 0U;
+      ptr_rw_info->i2c_arbitration_lost = 0U;
+    }
+  }
+
+  I2Cn_IrqRestore(ptr_ro_info, irq_en);
+
+  return status;
+}
+
+/**
+  \fn          uint32_t I2Cn_IrqDisable (const RO_Info_t * const ptr_ro_info)
+  \brief       Disable event and error interrupts of I2C instance.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \return      interrupts enabled before the call (bit 0 = event, bit 1 = error)
+*/
+static uint32_t I2Cn_IrqDisable (const RO_Info_t * const ptr_ro_info) {
+  uint32_t irq_en;
+
+  irq_en = 0U;
+  if (NVIC_GetEnableIRQ(ptr_ro_info->irq_ev) != 0U) {
+    irq_en |= 1U;
+  }
+  if (NVIC_GetEnableIRQ(ptr_ro_info->irq_er) != 0U) {
+    irq_en |= 2U;
+  }
+  NVIC_DisableIRQ(ptr_ro_info->irq_ev);
+  NVIC_DisableIRQ(ptr_ro_info->irq_er);
+
+  return irq_en;
+}
+
+/**
+  \fn          void I2Cn_IrqRestore (const RO_Info_t * const ptr_ro_info, uint32_t irq_en)
+  \brief       Restore event and error interrupts of I2C instance disabled by I2Cn_IrqDisable.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \param[in]   irq_en        Interrupts enabled before I2Cn_IrqDisable (its return value)
+*/
+static void I2Cn_IrqRestore (const RO_Info_t * const ptr_ro_info, uint32_t irq_en) {
+
+  if ((irq_en & 1U) != 0U) {
+    NVIC_EnableIRQ(ptr_ro_info->irq_ev);
+  }
+  if ((irq_en & 2U) != 0U) {
+    NVIC_EnableIRQ(ptr_ro_info->irq_er);
+  }
+}
+
+/**
+  \fn          uint32_t I2Cn_XferContinue (const RO_Info_t * const ptr_ro_info, uint32_t xfer_type)
+  \brief       Continue transfer with next chunk when previous chunk completed.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \param[in]   xfer_type     Transfer type (I2C_XFER_xxx)
+  \return      event to signal:
+                 - 0 = next chunk was started, nothing to signal
+                 - ARM_I2C_EVENT_TRANSFER_DONE = transfer completed
+                 - ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_TRANSFER_INCOMPLETE = next chunk could not be started
+*/
+static uint32_t I2Cn_XferContinue (const RO_Info_t * const ptr_ro_info, uint32_t xfer_type) {
+  RW_Info_t *ptr_rw_info;
+  uint8_t   *data;
+  uint32_t   num;
+  uint32_t   opt;
+
+  ptr_rw_info = ptr_ro_info->ptr_rw_info;
+
+  if (ptr_rw_info->xfer_rem == 0U) {
+    return ARM_I2C_EVENT_TRANSFER_DONE;
+  }
+
+  num = ptr_rw_info->xfer_rem;
+  if (num > I2C_XFER_CHUNK_MAX) {
+    num = I2C_XFER_CHUNK_MAX;
+  }
+  data = ptr_rw_info->xfer_next_data;
+
+  ptr_rw_info->xfer_done      += ptr_rw_info->xfer_size;
+  ptr_rw_info->xfer_size       = num;
+  ptr_rw_info->xfer_next_data  = &data[num];
+  ptr_rw_info->xfer_rem       -= num;
+
+  if (ptr_rw_info->xfer_rem == 0U) {
+    opt = ptr_rw_info->xfer_last_opt;
+  } else {
+    opt = I2C_NEXT_FRAME;
+  }
+
+  if (I2Cn_XferChunk(ptr_ro_info, xfer_type, ptr_rw_info->master_xfer_saddr, data, num, opt) != HAL_OK) {
+    ptr_rw_info->xfer_rem = 0U;
+    return ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_TRANSFER_INCOMPLETE;
+  }
+
+  return 0U;
+}
+
+#ifdef  I2C_VARIANT_TIMINGR
+/**
+  \fn          void I2Cn_ApplyCR1 (const RO_Info_t * const ptr_ro_info)
+  \brief       Apply CR1 register shadow (filters and SMBus settings) and TIMINGR register value
+                with a single peripheral disable/enable.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+*/
+static void I2Cn_ApplyCR1 (const RO_Info_t * const ptr_ro_info) {
+  uint32_t cr1;
+
+  cr1  = ptr_ro_info->ptr_hi2c->Instance->CR1;
+  cr1 &= ~(I2C_CR1_SHADOW_MASK | I2C_CR1_PE);
+  cr1 |=   ptr_ro_info->ptr_rw_info->cr1 & I2C_CR1_SHADOW_MASK;
+
+  // Filters and TIMINGR can only be changed while the peripheral is disabled
+  __HAL_I2C_DISABLE(ptr_ro_info->ptr_hi2c);
+  ptr_ro_info->ptr_hi2c->Instance->CR1     = cr1;
+  ptr_ro_info->ptr_hi2c->Instance->TIMINGR = ptr_ro_info->ptr_hi2c->Init.Timing;
+  __HAL_I2C_ENABLE(ptr_ro_info->ptr_hi2c);
+}
+#endif
+
+/**
+  \fn          int32_t I2Cn_PeriphInit (const RO_Info_t * const ptr_ro_info)
+  \brief       Initialize peripheral with HAL_I2C_Init and restore settings it does not preserve.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \return      \ref execution_status
+*/
+static int32_t I2Cn_PeriphInit (const RO_Info_t * const ptr_ro_info) {
+
+  if (HAL_I2C_Init(ptr_ro_info->ptr_hi2c) != HAL_OK) {
+    return ARM_DRIVER_ERROR;
+  }
+
+#ifdef  I2C_VARIANT_TIMINGR             // If this is variant with TIMINGR register
+  // HAL_I2C_Init destroys ANFOFF, DNF and SMBus settings in the CR1 register,
+  // restore them from the shadow at once instead of reconfiguring each filter separately
+  I2Cn_ApplyCR1(ptr_ro_info);
+#elif defined(I2C_VARIANT_HAS_FILTER)   // If I2C peripheral without TIMINGR register has filters
+  // Reconfigure Analog Noise Filter
+  if (ptr_ro_info->anf_en != 0U) {
+    if (HAL_I2CEx_ConfigAnalogFilter(ptr_ro_info->ptr_hi2c, I2C_ANALOGFILTER_ENABLE) != HAL_OK) {
+      return ARM_DRIVER_ERROR;
+    }
+  } else {
+    if (HAL_I2CEx_ConfigAnalogFilter(ptr_ro_info->ptr_hi2c, I2C_ANALOGFILTER_DISABLE) != HAL_OK) {
+      return ARM_DRIVER_ERROR;
+    }
+  }
+
+  // Reconfigure Digital Noise Filter
+  if (HAL_I2CEx_ConfigDigitalFilter(ptr_ro_info->ptr_hi2c, ptr_ro_info->dnf) != HAL_OK) {
+    return ARM_DRIVER_ERROR;
+  }
+#endif
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          uint32_t I2Cn_SMBusFlags (const RO_Info_t * const ptr_ro_info)
+  \brief       Check and clear SMBus flags.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \return      SMBus events (I2C_STM32_EVENT_SMBUS_xxx) corresponding to flags that were set
+*/
+static uint32_t I2Cn_SMBusFlags (const RO_Info_t * const ptr_ro_info) {
+  uint32_t event;
+#ifdef  I2C_VARIANT_TIMINGR             // If this is variant with TIMINGR register
+  uint32_t isr;
+
+  event = 0U;
+  isr   = ptr_ro_info->ptr_hi2c->Instance->ISR & (I2C_FLAG_PECERR | I2C_FLAG_TIMEOUT | I2C_FLAG_ALERT);
+
+  if (isr != 0U) {
+    // HAL I2C error interrupt handler does not clear SMBus flags
+    __HAL_I2C_CLEAR_FLAG(ptr_ro_info->ptr_hi2c, isr);
+  }
+
+  // Add flags cleared by error interrupt handler
+  isr |= ptr_ro_info->ptr_rw_info->smbus_isr;
+  ptr_ro_info->ptr_rw_info->smbus_isr = 0U;
+
+  if (isr != 0U) {
+    if ((isr & I2C_FLAG_PECERR) != 0U) {
+      event |= I2C_STM32_EVENT_SMBUS_PEC_ERROR;
+    }
+    if ((isr & I2C_FLAG_TIMEOUT) != 0U) {
+      event |= I2C_STM32_EVENT_SMBUS_TIMEOUT;
+    }
+    if ((isr & I2C_FLAG_ALERT) != 0U) {
+      event |= I2C_STM32_EVENT_SMBUS_ALERT;
+    }
+  }
+
+#else                                   // if this is I2C peripheral without TIMINGR register
+  (void)ptr_ro_info;
+
+  event = 0U;
+#endif
+
+  return event;
+}
+
+#ifdef  I2C_VARIANT_TIMINGR
+/**
+  \fn          void I2Cn_ER_IRQHandler (const RO_Info_t * const ptr_ro_info)
+  \brief       I2C error interrupt handler, clears SMBus flags that HAL error interrupt handler does not process
+                (they would keep entering the error interrupt) and calls HAL_I2C_ER_IRQHandler.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+*/
+static void I2Cn_ER_IRQHandler (const RO_Info_t * const ptr_ro_info) {
+  uint32_t isr;
+  uint32_t event;
+
+  isr = ptr_ro_info->ptr_hi2c->Instance->ISR & (I2C_FLAG_PECERR | I2C_FLAG_TIMEOUT | I2C_FLAG_ALERT);
+
+  if (isr != 0U) {
+    __HAL_I2C_CLEAR_FLAG(ptr_ro_info->ptr_hi2c, isr);
+
+    // PEC error is signaled when the transfer completes
+    ptr_ro_info->ptr_rw_info->smbus_isr |= isr & I2C_FLAG_PECERR;
+
+    event = 0U;
+    if ((isr & I2C_FLAG_TIMEOUT) != 0U) {
+      event |= I2C_STM32_EVENT_SMBUS_TIMEOUT;
+    }
+    if ((isr & I2C_FLAG_ALERT) != 0U) {
+      event |= I2C_STM32_EVENT_SMBUS_ALERT;
+    }
+    if ((event != 0U) && (ptr_ro_info->ptr_rw_info->cb_event != NULL)) {
+      ptr_ro_info->ptr_rw_info->cb_event(event);
+    }
+  }
+
+  HAL_I2C_ER_IRQHandler(ptr_ro_info->ptr_hi2c);
+}
+#endif
+
+/**
+  \fn          void I2Cn_StreamArm (const RO_Info_t * const ptr_ro_info)
+  \brief       Request reception of Slave receive stream data up to the end of the ring buffer.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+*/
+static void I2Cn_StreamArm (const RO_Info_t * const ptr_ro_info) {
+  RW_Info_t              *ptr_rw_info;
+  I2C_STM32_SLAVE_STREAM *stream;
+  uint32_t                offset;
+
+  ptr_rw_info = ptr_ro_info->ptr_rw_info;
+  stream      = ptr_rw_info->stream;
+
+  offset = stream->head % stream->size;
+
+  ptr_rw_info->stream_seg_num = stream->size - offset;
+  if (I2Cn_XferChunk(ptr_ro_info, I2C_XFER_SLAVE_RX, 0U, &stream->data[offset], ptr_rw_info->stream_seg_num, I2C_NEXT_FRAME) != HAL_OK) {
+    ptr_rw_info->stream_seg_num = 0U;
+  }
+}
+
+/**
+  \fn          void I2Cn_StreamEnd (const RO_Info_t * const ptr_ro_info)
+  \brief       Finish Slave receive stream write transaction and signal its length.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+*/
+static void I2Cn_StreamEnd (const RO_Info_t * const ptr_ro_info) {
+  RW_Info_t              *ptr_rw_info;
+  I2C_STM32_SLAVE_STREAM *stream;
+  uint32_t                num;
+  uint32_t                event;
+
+  ptr_rw_info = ptr_ro_info->ptr_rw_info;
+  stream      = ptr_rw_info->stream;
+
+  if (ptr_rw_info->stream_active == 0U) {
+    return;
+  }
+  ptr_rw_info->stream_active = 0U;
+
+  // Bytes received in current segment
+  num = 0U;
+  if (ptr_rw_info->stream_seg_num > ptr_ro_info->ptr_hi2c->XferCount) {
+    num = ptr_rw_info->stream_seg_num - ptr_ro_info->ptr_hi2c->XferCount;
+  }
+  ptr_rw_info->stream_seg_num = 0U;
+
+  stream->head     += num;
+  stream->xfer_num  = ptr_rw_info->stream_xfer_num + num;
+
+  event = I2C_STM32_EVENT_SLAVE_STREAM_RECEIVE;
+  if ((stream->head - stream->tail) > stream->size) {
+    // Unread data was overwritten
+    event |= I2C_STM32_EVENT_SLAVE_STREAM_OVERFLOW;
+  }
+
+  if (ptr_rw_info->cb_event != NULL) {
+    ptr_rw_info->cb_event(event);
+  }
+}
+
+/**
+  \fn          void I2Cn_RegFileAddr (const RO_Info_t * const ptr_ro_info, uint8_t direction)
+  \brief       Start Slave register file access on address match.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \param[in]   direction     Master request transfer direction (I2C_DIRECTION_TRANSMIT or I2C_DIRECTION_RECEIVE)
+*/
+static void I2Cn_RegFileAddr (const RO_Info_t * const ptr_ro_info, uint8_t direction) {
+  RW_Info_t *ptr_rw_info;
+
+  ptr_rw_info = ptr_ro_info->ptr_rw_info;
+
+  // Finish previous access if repeated START follows it
+  I2Cn_RegFileAccessEnd(ptr_ro_info);
+
+  if (direction == I2C_DIRECTION_TRANSMIT) {    // If Master writes, first byte is register address
+    ptr_rw_info->reg_state   = I2C_REG_STATE_ADDR;
+    ptr_rw_info->reg_seg_num = 1U;
+    (void)HAL_I2C_Slave_Seq_Receive_IT (ptr_ro_info->ptr_hi2c, &ptr_rw_info->reg_addr, 1U, I2C_NEXT_FRAME);
+  } else {                                      // If Master reads, transmit registers from register pointer on
+    ptr_rw_info->reg_blk_addr = ptr_rw_info->reg_ptr;
+    ptr_rw_info->reg_blk_num  = 0U;
+    ptr_rw_info->reg_state    = I2C_REG_STATE_READ;
+    ptr_rw_info->reg_seg_num  = (uint16_t)(ptr_rw_info->reg_file->size - ptr_rw_info->reg_ptr);
+    (void)HAL_I2C_Slave_Seq_Transmit_IT(ptr_ro_info->ptr_hi2c, &ptr_rw_info->reg_file->data[ptr_rw_info->reg_ptr], ptr_rw_info->reg_seg_num, I2C_NEXT_FRAME);
+  }
+}
+
+/**
+  \fn          void I2Cn_RegFileXferCplt (const RO_Info_t * const ptr_ro_info)
+  \brief       Continue Slave register file access when requested bytes were transferred.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+*/
+static void I2Cn_RegFileXferCplt (const RO_Info_t * const ptr_ro_info) {
+  RW_Info_t *ptr_rw_info;
+
+  ptr_rw_info = ptr_ro_info->ptr_rw_info;
+
+  switch (ptr_rw_info->reg_state) {
+    case I2C_REG_STATE_ADDR:            // Register address received, receive register data
+      ptr_rw_info->reg_ptr      = (uint16_t)(ptr_rw_info->reg_addr % ptr_rw_info->reg_file->size);
+      ptr_rw_info->reg_blk_addr = ptr_rw_info->reg_ptr;
+      ptr_rw_info->reg_blk_num  = 0U;
+      ptr_rw_info->reg_state    = I2C_REG_STATE_WRITE;
+      ptr_rw_info->reg_seg_num  = (uint16_t)(ptr_rw_info->reg_file->size - ptr_rw_info->reg_ptr);
+      (void)HAL_I2C_Slave_Seq_Receive_IT (ptr_ro_info->ptr_hi2c, &ptr_rw_info->reg_file->data[ptr_rw_info->reg_ptr], ptr_rw_info->reg_seg_num, I2C_NEXT_FRAME);
+      break;
+
+    case I2C_REG_STATE_WRITE:           // End of register file written, wrap around to first register
+      ptr_rw_info->reg_blk_num += ptr_rw_info->reg_seg_num;
+      ptr_rw_info->reg_seg_num  = (uint16_t)ptr_rw_info->reg_file->size;
+      (void)HAL_I2C_Slave_Seq_Receive_IT (ptr_ro_info->ptr_hi2c, ptr_rw_info->reg_file->data, ptr_rw_info->reg_seg_num, I2C_NEXT_FRAME);
+      break;
+
+    case I2C_REG_STATE_READ:            // End of register file read, wrap around to first register
+      ptr_rw_info->reg_blk_num  = (uint16_t)((ptr_rw_info->reg_blk_num + ptr_rw_info->reg_seg_num) % ptr_rw_info->reg_file->size);
+      ptr_rw_info->reg_seg_num  = (uint16_t)ptr_rw_info->reg_file->size;
+      (void)HAL_I2C_Slave_Seq_Transmit_IT(ptr_ro_info->ptr_hi2c, ptr_rw_info->reg_file->data, ptr_rw_info->reg_seg_num, I2C_NEXT_FRAME);
+      break;
+
+    default:
+      break;
+  }
+}
+
+/**
+  \fn          void I2Cn_RegFileAccessEnd (const RO_Info_t * const ptr_ro_info)
+  \brief       Finish Slave register file write or read access and update register pointer.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+*/
+static void I2Cn_RegFileAccessEnd (const RO_Info_t * const ptr_ro_info) {
+  RW_Info_t *ptr_rw_info;
+  uint32_t   num;
+
+  ptr_rw_info = ptr_ro_info->ptr_rw_info;
+
+  if (ptr_rw_info->reg_state == I2C_REG_STATE_WRITE) {
+    // Number of registers written: previous segments and received bytes of current segment
+    num = ptr_rw_info->reg_blk_num + (ptr_rw_info->reg_seg_num - ptr_ro_info->ptr_hi2c->XferCount);
+    if (num > ptr_rw_info->reg_file->size) {
+      num = ptr_rw_info->reg_file->size;
+    }
+    if (num != 0U) {
+      ptr_rw_info->reg_wr_addr = ptr_rw_info->reg_blk_addr;
+      ptr_rw_info->reg_wr_num  = (uint16_t)num;
+    }
+
+    // Register pointer continues after the last written register
+    ptr_rw_info->reg_ptr = (uint16_t)((ptr_rw_info->reg_blk_addr + num) % ptr_rw_info->reg_file->size);
+  }
+
+  if (ptr_rw_info->reg_state == I2C_REG_STATE_READ) {
+    // Number of registers loaded for transmission: previous segments and current segment
+    num = ptr_rw_info->reg_blk_num + (ptr_rw_info->reg_seg_num - ptr_ro_info->ptr_hi2c->XferCount);
+
+    // Master NACKs the last read byte while the next byte is already loaded, so it was not transmitted
+    if (num != 0U) {
+      num--;
+    }
+
+    // Register pointer continues after the last read register
+    ptr_rw_info->reg_ptr = (uint16_t)((ptr_rw_info->reg_blk_addr + num) % ptr_rw_info->reg_file->size);
+  }
+
+  ptr_rw_info->reg_state = I2C_REG_STATE_IDLE;
+}
+
+/**
+  \fn          void I2Cn_RegFileStop (const RO_Info_t * const ptr_ro_info)
+  \brief       Finish Slave register file access on STOP and signal written registers.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+*/
+static void I2Cn_RegFileStop (const RO_Info_t * const ptr_ro_info) {
+  RW_Info_t *ptr_rw_info;
+
+  ptr_rw_info = ptr_ro_info->ptr_rw_info;
+
+  I2Cn_RegFileAccessEnd(ptr_ro_info);
+
+  if (ptr_rw_info->reg_wr_num != 0U) {
+    ptr_rw_info->reg_file->wr_addr = ptr_rw_info->reg_wr_addr;
+    ptr_rw_info->reg_file->wr_num  = ptr_rw_info->reg_wr_num;
+    ptr_rw_info->reg_wr_num        = 0U;
+
+    if (ptr_rw_info->cb_event != NULL) {
+      ptr_rw_info->cb_event(I2C_STM32_EVENT_SLAVE_REG_WRITE);
+    }
+  }
+}
+
+/**
+  \fn          int32_t I2Cn_SlaveTransmit (const RO_Info_t * const ptr_ro_info, const uint8_t *data, uint32_t num)
+  \brief       Start transmitting data as I2C Slave.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \param[in]   data          Pointer to buffer with data to transmit to I2C Master
+  \param[in]   num           Number of data bytes to transmit
+  \return      \ref execution_status
+*/
+static int32_t I2Cn_SlaveTransmit (const RO_Info_t * const ptr_ro_info, const uint8_t *data, uint32_t num) {
+
+  if ((data == NULL) || (num == 0U)) {
+    // If any parameter is invalid
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if (ptr_ro_info->ptr_rw_info->drv_status.powered == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (I2Cn_GetStatus(ptr_ro_info).busy != 0U) {
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  if ((HAL_I2C_GetState(ptr_ro_info->ptr_hi2c) != HAL_I2C_STATE_LISTEN) ||
+      (ptr_ro_info->ptr_rw_info->reg_file != NULL)) {
+    // If not listening or Slave accesses are served by register file emulation
+    return ARM_DRIVER_ERROR;
+  }
+
+  ptr_ro_info->ptr_rw_info->i2c_bus_error       = 0U;
+  ptr_ro_info->ptr_rw_info->i2c_general_call    = 0U;
+
+  ptr_ro_info->ptr_rw_info->xfer_size           = 0U;
+  ptr_ro_info->ptr_rw_info->xfer_done           = 0U;
+
+  // Just register transmit parameters, actual operation will be started from HAL_I2C_AddrCallback
+  ptr_ro_info->ptr_rw_info->slave_xfer_tx_data  = data;
+  ptr_ro_info->ptr_rw_info->slave_xfer_tx_num   = num;
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t I2Cn_SlaveReceive (const RO_Info_t * const ptr_ro_info, uint8_t *data, uint32_t num)
+  \brief       Start receiving data as I2C Slave.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \param[out]  data          Pointer to buffer for data to receive from I2C Master
+  \param[in]   num           Number of data bytes to receive
+  \return      \ref execution_status
+*/
+static int32_t I2Cn_SlaveReceive (const RO_Info_t * const ptr_ro_info, uint8_t *data, uint32_t num) {
+
+  if ((data == NULL) || (num == 0U)) {
+    // If any parameter is invalid
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if (ptr_ro_info->ptr_rw_info->drv_status.powered == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (I2Cn_GetStatus(ptr_ro_info).busy != 0U) {
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  if ((ptr_ro_info->ptr_rw_info->reg_file != NULL) || (ptr_ro_info->ptr_rw_info->stream != NULL)) {
+    // If Slave accesses are served by register file emulation or receive stream
+    return ARM_DRIVER_ERROR;
+  }
+
+  ptr_ro_info->ptr_rw_info->i2c_bus_error       = 0U;
+  ptr_ro_info->ptr_rw_info->i2c_general_call    = 0U;
+
+  ptr_ro_info->ptr_rw_info->xfer_size           = 0U;
+  ptr_ro_info->ptr_rw_info->xfer_done           = 0U;
+
+  // Just register receive parameters, actual operation will be started from HAL_I2C_AddrCallback
+  ptr_ro_info->ptr_rw_info->slave_xfer_rx_data  = data;
+  ptr_ro_info->ptr_rw_info->slave_xfer_rx_num   = num;
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t I2Cn_AbortTransferAsync (const RO_Info_t * const ptr_ro_info, uint32_t spin_us)
+  \brief       Abort transfer without blocking, completion is signaled with I2C_STM32_EVENT_ABORT_DONE event.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \param[in]   spin_us       Max time to wait for abort completion (in us), 0 = do not wait
+  \return      \ref execution_status
+*/
+static int32_t I2Cn_AbortTransferAsync (const RO_Info_t * const ptr_ro_info, uint32_t spin_us) {
+  uint32_t cnt;
+
+  if (spin_us > 1000000U) {
+    // Wait time is limited to 1 second
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  switch (HAL_I2C_GetMode(ptr_ro_info->ptr_hi2c)) {
+    case HAL_I2C_MODE_MASTER:           // I2C communication is in Master Mode
+      if (ptr_ro_info->ptr_rw_info->xfer_abort_async != 0U) {
+        // Abort is already in progress
+        break;
+      }
+
+      ptr_ro_info->ptr_rw_info->xfer_abort       = 0U;
+      ptr_ro_info->ptr_rw_info->xfer_abort_async = 1U;
+
+      // Discard remaining chunks and receive that would follow the transmit, abort generates STOP
+      ptr_ro_info->ptr_rw_info->xfer_rem            = 0U;
+      ptr_ro_info->ptr_rw_info->master_xfer_rx_data = NULL;
+      ptr_ro_info->ptr_rw_info->xfer_no_stop        = 0U;
+
+      // Abort completion is signaled from HAL_I2C_AbortCpltCallback
+      if (HAL_I2C_Master_Abort_IT(ptr_ro_info->ptr_hi2c, (uint16_t)ptr_ro_info->ptr_hi2c->Init.OwnAddress1) != HAL_OK) {
+        ptr_ro_info->ptr_rw_info->xfer_abort_async = 0U;
+        return ARM_DRIVER_ERROR;
+      }
+      break;
+
+    case HAL_I2C_MODE_SLAVE:            // I2C communication is in Slave Mode
+      ptr_ro_info->ptr_rw_info->xfer_rem = 0U;
+
+      // Generate NACK when in Slave mode
+#ifdef  I2C_VARIANT_TIMINGR             // If this is variant with TIMINGR register
+      __HAL_I2C_GENERATE_NACK(ptr_ro_info->ptr_hi2c);
+#else                                   // if this is I2C peripheral without TIMINGR register
+      ptr_ro_info->ptr_hi2c->Instance->CR1 &= ~I2C_CR1_ACK;
+#endif
+      // Abort completes immediately
+      if (ptr_ro_info->ptr_rw_info->cb_event != NULL) {
+        ptr_ro_info->ptr_rw_info->cb_event(I2C_STM32_EVENT_ABORT_DONE);
+      }
+      return ARM_DRIVER_OK;
+
+    case HAL_I2C_MODE_NONE:             // No I2C communication on going
+      // Nothing to abort
+      if (ptr_ro_info->ptr_rw_info->cb_event != NULL) {
+        ptr_ro_info->ptr_rw_info->cb_event(I2C_STM32_EVENT_ABORT_DONE);
+      }
+      return ARM_DRIVER_OK;
+
+    case HAL_I2C_MODE_MEM:              // I2C communication is in Memory Mode
+    default:
+      return ARM_DRIVER_ERROR;
+  }
+
+  if (spin_us == 0U) {
+    return ARM_DRIVER_OK;
+  }
+
+  // Wait for abort completion, every loop iteration takes at least one core clock cycle
+  cnt = (SystemCoreClock / 1000000U) * spin_us;
+  while (ptr_ro_info->ptr_rw_info->xfer_abort == 0U) {
+    if (cnt == 0U) {
+      // Abort did not complete in time, completion is still signaled with the event
+      return ARM_DRIVER_ERROR_TIMEOUT;
+    }
+    cnt--;
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t I2Cn_GetDataCount (const RO_Info_t * const ptr_ro_info)
+  \brief       Get transferred data count.
+  \param[in]   ptr_ro_info   Pointer to I2C RO info structure (RO_Info_t)
+  \return      number of data bytes transferred; -1 when Slave is not addressed by Master
+*/
+static int32_t I2Cn_GetDataCount (const RO_Info_t * const ptr_ro_info) {
+  int32_t cnt;
+  int32_t cnt_xferred;
+  uint8_t cnt_xferred_valid;
+
+  if (ptr_ro_info->ptr_rw_info->drv_status.powered == 0U) {
+    return 0;
+  }
+
+  if (HAL_I2C_GetState(ptr_ro_info->ptr_hi2c) == HAL_I2C_STATE_LISTEN) {
+    cnt = -1;
+  } else {
+    cnt_xferred       = 0;
+    cnt_xferred_valid = 0U;
+    if (ptr_ro_info->ptr_hi2c->hdmarx != NULL) {        // If DMA is used for Rx
+      if (ptr_ro_info->ptr_hi2c->hdmarx->State == HAL_DMA_STATE_BUSY) {
+        // If reception is in progress
+        cnt_xferred       = (int32_t)__HAL_DMA_GET_COUNTER(ptr_ro_info->ptr_hi2c->hdmarx);
+        cnt_xferred_valid = 1U;
+      }
+    }
     if ((ptr_ro_info->ptr_hi2c->hdmatx != NULL) &&      // If DMA is used for Tx
         (cnt_xferred_valid == 0U)) {                    // and not valid
       if (ptr_ro_info->ptr_hi2c->hdmatx->State == HAL_DMA_STATE_BUSY) {
@@ -1254,7 +2709,7 @@ static int32_t I2Cn_GetDataCount (const RO_Info_t * const ptr_ro_info) {
       cnt_xferred = (int32_t)ptr_ro_info->ptr_hi2c->XferCount;
     }
 
-    cnt = (int32_t)ptr_ro_info->ptr_rw_info->xfer_size - cnt_xferred;
+    cnt = (int32_t)(ptr_ro_info->ptr_rw_info->xfer_done + ptr_ro_info->ptr_rw_info->xfer_size) - cnt_xferred;
   }
 
   return cnt;
@@ -1274,10 +2729,13 @@ static int32_t I2Cn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
         GPIO_PinState       state;
         uint32_t            i;
         uint32_t            periph_clk;
+        uint32_t            primask;
+        uint32_t            event;
+        I2C_STM32_SLAVE_REG_FILE *ptr_reg_file;
+        I2C_STM32_SLAVE_STREAM   *ptr_stream;
 #ifdef  I2C_VARIANT_TIMINGR             // If TIMINGR register exists
-  const StandardTiming_t   *ptr_std_timing;
-        ClockSetup_t        clock_setup;
-        uint32_t            scl_freq;
+        uint32_t            timing;
+        uint32_t            mask;
 #endif
 
   if (ptr_ro_info->ptr_rw_info->drv_status.powered == 0U) {
@@ -1294,6 +2752,11 @@ static int32_t I2Cn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
       case HAL_I2C_MODE_MASTER:         // I2C communication is in Master Mode
         ptr_ro_info->ptr_rw_info->xfer_abort = 0U;
 
+        // Discard remaining chunks and receive that would follow the transmit, abort generates STOP
+        ptr_ro_info->ptr_rw_info->xfer_rem            = 0U;
+        ptr_ro_info->ptr_rw_info->master_xfer_rx_data = NULL;
+        ptr_ro_info->ptr_rw_info->xfer_no_stop        = 0U;
+
         if (HAL_I2C_Master_Abort_IT(ptr_ro_info->ptr_hi2c, (uint16_t)ptr_ro_info->ptr_hi2c->Init.OwnAddress1) != HAL_OK) {
           return ARM_DRIVER_ERROR;
         }
@@ -1313,6 +2776,8 @@ static int32_t I2Cn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
         break;
 
       case HAL_I2C_MODE_SLAVE:          // I2C communication is in Slave Mode
+        ptr_ro_info->ptr_rw_info->xfer_rem = 0U;
+
         // Generate NACK when in Slave mode
 #ifdef  I2C_VARIANT_TIMINGR             // If this is variant with TIMINGR register
         __HAL_I2C_GENERATE_NACK(ptr_ro_info->ptr_hi2c);
@@ -1329,12 +2794,34 @@ static int32_t I2Cn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
     return ARM_DRIVER_OK;
   }
 
+  // Special handling for Abort Transfer without blocking command
+  if (control == I2C_STM32_ABORT_TRANSFER_ASYNC) {
+    return I2Cn_AbortTransferAsync(ptr_ro_info, arg);
+  }
+
+  // SMBus flags can be checked also while peripheral is busy
+  if (control == I2C_STM32_SMBUS_CHECK_FLAGS) {
+    event = I2Cn_SMBusFlags(ptr_ro_info);
+    if ((event != 0U) && (ptr_ro_info->ptr_rw_info->cb_event != NULL)) {
+      ptr_ro_info->ptr_rw_info->cb_event(event);
+    }
+    return ARM_DRIVER_OK;
+  }
+
+  // Transfer can be queued also while peripheral is busy
+  if (control == I2C_STM32_QUEUE_TRANSFER) {
+    return I2Cn_QueueTransfer(ptr_ro_info, (I2C_STM32_QUEUE_XFER *)arg);
+  }
+
   // Check if peripheral is busy
   if (I2Cn_GetStatus(ptr_ro_info).busy != 0U) {
     return ARM_DRIVER_ERROR_BUSY;
   }
 
   switch (control) {
+    case I2C_STM32_MASTER_TRANSMIT_RECEIVE:     // Start Master transmit and receive; arg = pointer to I2C_STM32_MASTER_XFER
+      return I2Cn_MasterTransmitReceive(ptr_ro_info, (const I2C_STM32_MASTER_XFER *)arg);
+
     case ARM_I2C_OWN_ADDRESS:                   // Set Own Slave Address; arg = address
       if (arg == 0U) {                          // Disable Slave
         if (HAL_I2C_DisableListen_IT(ptr_ro_info->ptr_hi2c) != HAL_OK) {
@@ -1360,27 +2847,9 @@ static int32_t I2Cn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
         ptr_ro_info->ptr_hi2c->Init.OwnAddress1 = (arg << 1) & 0x03FFU;
 
         // Update the Own Address configuration
-        if (HAL_I2C_Init(ptr_ro_info->ptr_hi2c) != HAL_OK) {
-          return ARM_DRIVER_ERROR;
-        }
-
-#ifdef  I2C_VARIANT_HAS_FILTER                  // If I2C peripheral has filters
-        // Reconfigure Analog Noise Filter because HAL_I2C_Init destroys ANFOFF setting in the CR1 register
-        if (ptr_ro_info->anf_en != 0U) {
-          if (HAL_I2CEx_ConfigAnalogFilter(ptr_ro_info->ptr_hi2c, I2C_ANALOGFILTER_ENABLE) != HAL_OK) {
-            return ARM_DRIVER_ERROR;
-          }
-        } else {
-          if (HAL_I2CEx_ConfigAnalogFilter(ptr_ro_info->ptr_hi2c, I2C_ANALOGFILTER_DISABLE) != HAL_OK) {
-            return ARM_DRIVER_ERROR;
-          }
-        }
-
-        // Reconfigure Digital Noise Filter because HAL_I2C_Init destroys DNF setting in the CR1 register
-        if (HAL_I2CEx_ConfigDigitalFilter(ptr_ro_info->ptr_hi2c, ptr_ro_info->dnf) != HAL_OK) {
+        if (I2Cn_PeriphInit(ptr_ro_info) != ARM_DRIVER_OK) {
           return ARM_DRIVER_ERROR;
         }
-#endif
 
         // Enable the Address listen mode
         if (HAL_I2C_EnableListen_IT(ptr_ro_info->ptr_hi2c) != HAL_OK) {
@@ -1390,6 +2859,7 @@ static int32_t I2Cn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
       break;
 
     case ARM_I2C_BUS_SPEED:                     // Set Bus Speed; arg = speed
+    case I2C_STM32_SET_BUS_SPEED_HZ:            // Set Bus Speed; arg = SCL frequency (in Hz)
       periph_clk = I2Cn_GetPeriphClock(ptr_ro_info);
       if (periph_clk == 0U) {
         // If peripheral clock is unknown
@@ -1397,70 +2867,55 @@ static int32_t I2Cn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
       }
 
 #ifdef  I2C_VARIANT_TIMINGR                     // If TIMINGR register exists
-      switch (arg) {
-        case ARM_I2C_BUS_SPEED_STANDARD:        // Standard Speed (100kHz)
-          ptr_std_timing = &i2c_spec_standard;
-          scl_freq = 100000U;
-          break;
-
-        case ARM_I2C_BUS_SPEED_FAST:            // Fast Speed (400kHz)
-          ptr_std_timing = &i2c_spec_fast;
-          scl_freq = 400000U;
-          break;
-
-        case ARM_I2C_BUS_SPEED_FAST_PLUS:       // Fast+ Speed (1MHz)
-          ptr_std_timing = &i2c_spec_fast_plus;
-          scl_freq = 1000000U;
-          break;
-
-        default:
+      if (control == I2C_STM32_SET_BUS_SPEED_HZ) {
+        if ((arg == 0U) || (arg > i2c_spec_fast_plus.clk_max)) {
           return ARM_DRIVER_ERROR_UNSUPPORTED;
-      }
-
-      // Determine peripheral and bus clock period (in ns)
-      clock_setup.i2cclk = (uint16_t)((1000000000U + (periph_clk / 2)) / periph_clk);
-      clock_setup.busclk = (uint16_t)((1000000000U + (scl_freq   / 2)) / scl_freq);
-
-      // Determine digital filter delay (in ns)
-      clock_setup.dfd = clock_setup.i2cclk * ((ptr_ro_info->ptr_hi2c->Instance->CR1 & I2C_CR1_DNF) >> 8);
+        }
 
-      // Set analog filter delay (in ns)
-      if (ptr_ro_info->anf_en != 0U) {
-        clock_setup.afd_min = I2C_ANALOG_FILTER_DELAY_MIN;
-        clock_setup.afd_max = I2C_ANALOG_FILTER_DELAY_MAX;
+        // Determine TIMINGR register value for requested frequency
+        timing = I2Cn_GetTimingFreq(ptr_ro_info, periph_clk, arg, (ptr_ro_info->ptr_rw_info->cr1 & I2C_CR1_DNF) >> I2C_CR1_DNF_Pos);
       } else {
-        clock_setup.afd_min = 0U;
-        clock_setup.afd_max = 0U;
-      }
-
-      // Set max iteration error
-      clock_setup.error = 0xFFFF;
+        if ((arg != ARM_I2C_BUS_SPEED_STANDARD) &&
+            (arg != ARM_I2C_BUS_SPEED_FAST)     &&
+            (arg != ARM_I2C_BUS_SPEED_FAST_PLUS)) {
+          return ARM_DRIVER_ERROR_UNSUPPORTED;
+        }
 
-      // Get TIMINGR register values
-      ptr_ro_info->ptr_hi2c->Init.Timing = I2Cn_GetTimingValue(&clock_setup, ptr_std_timing);
-#else                                   // If this is I2C peripheral without filter capabilities
-      ptr_ro_info->ptr_hi2c->Init.ClockSpeed = arg;
-#endif
+        // Get TIMINGR register value (build-time, previously determined or determined now)
+        timing = I2Cn_GetTiming(ptr_ro_info, periph_clk, arg);
+      }
 
-      // Update the bus speed configuration
-      if (HAL_I2C_Init(ptr_ro_info->ptr_hi2c) != HAL_OK) {
-        return ARM_DRIVER_ERROR;
+      if (timing == 0U) {
+        // If requested bus speed cannot be achieved with this peripheral clock
+        return ARM_DRIVER_ERROR_UNSUPPORTED;
       }
 
-#ifdef  I2C_VARIANT_HAS_FILTER          // If I2C peripheral has filters
-      // Reconfigure Analog Noise Filter because HAL_I2C_Init destroys ANFOFF setting in the CR1 register
-      if (ptr_ro_info->anf_en != 0U) {
-        if (HAL_I2CEx_ConfigAnalogFilter(ptr_ro_info->ptr_hi2c, I2C_ANALOGFILTER_ENABLE) != HAL_OK) {
-          return ARM_DRIVER_ERROR;
+      // Only TIMINGR changes, so write it directly instead of re-initializing the peripheral
+      ptr_ro_info->ptr_hi2c->Init.Timing = timing;
+      I2Cn_ApplyCR1(ptr_ro_info);
+#else                                   // If this is I2C peripheral without TIMINGR register
+      if (control == I2C_STM32_SET_BUS_SPEED_HZ) {
+        if ((arg == 0U) || (arg > 400000U)) {
+          return ARM_DRIVER_ERROR_UNSUPPORTED;
         }
+        ptr_ro_info->ptr_hi2c->Init.ClockSpeed = arg;
       } else {
-        if (HAL_I2CEx_ConfigAnalogFilter(ptr_ro_info->ptr_hi2c, I2C_ANALOGFILTER_DISABLE) != HAL_OK) {
-          return ARM_DRIVER_ERROR;
+        switch (arg) {
+          case ARM_I2C_BUS_SPEED_STANDARD:      // Standard Speed (100kHz)
+            ptr_ro_info->ptr_hi2c->Init.ClockSpeed = 100000U;
+            break;
+
+          case ARM_I2C_BUS_SPEED_FAST:          // Fast Speed (400kHz)
+            ptr_ro_info->ptr_hi2c->Init.ClockSpeed = 400000U;
+            break;
+
+          default:
+            return ARM_DRIVER_ERROR_UNSUPPORTED;
         }
       }
 
-      // Reconfigure Digital Noise Filter because HAL_I2C_Init destroys DNF setting in the CR1 register
-      if (HAL_I2CEx_ConfigDigitalFilter(ptr_ro_info->ptr_hi2c, ptr_ro_info->dnf) != HAL_OK) {
+      // Update the bus speed configuration
+      if (I2Cn_PeriphInit(ptr_ro_info) != ARM_DRIVER_OK) {
         return ARM_DRIVER_ERROR;
       }
 #endif
@@ -1533,6 +2988,128 @@ static int32_t I2Cn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
 
       return ARM_DRIVER_OK;
 
+    case I2C_STM32_SMBUS_PEC:                   // SMBus hardware PEC; arg: 0 = disabled, 1 = enabled
+    case I2C_STM32_SMBUS_ALERT:                 // SMBus Host SMBALERT detection; arg: 0 = disabled, 1 = enabled
+#ifdef  I2C_VARIANT_TIMINGR             // If this is variant with TIMINGR register
+      if (arg > 1U) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      if (control == I2C_STM32_SMBUS_PEC) {
+        mask = I2C_CR1_PECEN;
+      } else {
+        // SMBALERT is detected on SMBA pin when peripheral is SMBus Host
+        mask = I2C_CR1_SMBHEN | I2C_CR1_ALERTEN;
+      }
+      if (arg != 0U) {
+        ptr_ro_info->ptr_rw_info->cr1 |=  mask;
+      } else {
+        ptr_ro_info->ptr_rw_info->cr1 &= ~mask;
+      }
+      I2Cn_ApplyCR1(ptr_ro_info);
+      break;
+#else                                   // if this is I2C peripheral without TIMINGR register
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+
+    case I2C_STM32_SET_MAX_DNF:                 // Set Bus Speed with largest digital noise filter meeting SCL timing; arg = SCL frequency (in Hz)
+#ifdef  I2C_VARIANT_TIMINGR             // If this is variant with TIMINGR register
+      periph_clk = I2Cn_GetPeriphClock(ptr_ro_info);
+      if ((periph_clk == 0U) || (arg == 0U) || (arg > i2c_spec_fast_plus.clk_max)) {
+        return ARM_DRIVER_ERROR_UNSUPPORTED;
+      }
+
+      // Digital filter delay reduces the SCL timing margins, so try from the largest DNF value down
+      timing = 0U;
+      for (i = 0U; i <= I2C_DNF_MAX; i++) {
+        timing = I2Cn_GetTimingFreq(ptr_ro_info, periph_clk, arg, I2C_DNF_MAX - i);
+        if (timing != 0U) {
+          break;
+        }
+      }
+
+      if (timing == 0U) {
+        // If requested SCL frequency cannot be achieved even without digital filter
+        return ARM_DRIVER_ERROR_UNSUPPORTED;
+      }
+
+      mask = ((I2C_DNF_MAX - i) << I2C_CR1_DNF_Pos) & I2C_CR1_DNF;
+      if ((ptr_ro_info->ptr_rw_info->cr1 & I2C_CR1_DNF) != mask) {
+        // TIMINGR values determined at run-time are valid only for the digital filter they were determined with
+        memset((void *)ptr_ro_info->ptr_rw_info->timingr, 0, sizeof(ptr_ro_info->ptr_rw_info->timingr));
+        ptr_ro_info->ptr_rw_info->cr1 = (ptr_ro_info->ptr_rw_info->cr1 & ~I2C_CR1_DNF) | mask;
+      }
+
+      // Digital filter and TIMINGR change at once
+      ptr_ro_info->ptr_hi2c->Init.Timing = timing;
+      I2Cn_ApplyCR1(ptr_ro_info);
+      break;
+#else                                   // if this is I2C peripheral without TIMINGR register
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+
+    case I2C_STM32_SMBUS_TIMEOUT:               // SMBus timeouts; arg = TIMEOUTR register value (0 = disabled)
+#ifdef  I2C_VARIANT_TIMINGR             // If this is variant with TIMINGR register
+      // Timeout values can only be changed while timeouts are disabled
+      ptr_ro_info->ptr_hi2c->Instance->TIMEOUTR = 0U;
+      ptr_ro_info->ptr_hi2c->Instance->TIMEOUTR = arg & ~(I2C_TIMEOUTR_TIMOUTEN | I2C_TIMEOUTR_TEXTEN);
+      ptr_ro_info->ptr_hi2c->Instance->TIMEOUTR = arg;
+      break;
+#else                                   // if this is I2C peripheral without TIMINGR register
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+
+    case I2C_STM32_SET_SLAVE_REG_FILE:          // Set Slave register file emulation; arg = pointer to I2C_STM32_SLAVE_REG_FILE
+      ptr_reg_file = (I2C_STM32_SLAVE_REG_FILE *)arg;
+      if (ptr_reg_file != NULL) {
+        if (ptr_ro_info->ptr_rw_info->stream != NULL) {
+          // Register file emulation and receive stream cannot be used at the same time
+          return ARM_DRIVER_ERROR;
+        }
+        if ((ptr_reg_file->data == NULL) || (ptr_reg_file->size == 0U) || (ptr_reg_file->size > 256U)) {
+          return ARM_DRIVER_ERROR_PARAMETER;
+        }
+        ptr_reg_file->wr_addr = 0U;
+        ptr_reg_file->wr_num  = 0U;
+      }
+
+      primask = __get_PRIMASK();
+      __disable_irq();
+
+      ptr_ro_info->ptr_rw_info->reg_file    = ptr_reg_file;
+      ptr_ro_info->ptr_rw_info->reg_state   = I2C_REG_STATE_IDLE;
+      ptr_ro_info->ptr_rw_info->reg_ptr     = 0U;
+      ptr_ro_info->ptr_rw_info->reg_wr_num  = 0U;
+
+      __set_PRIMASK(primask);
+      break;
+
+    case I2C_STM32_SLAVE_RECEIVE_STREAM:        // Set Slave receive streaming into ring buffer; arg = pointer to I2C_STM32_SLAVE_STREAM
+      ptr_stream = (I2C_STM32_SLAVE_STREAM *)arg;
+      if (ptr_stream != NULL) {
+        if ((ptr_stream->data == NULL) || (ptr_stream->size == 0U) || (ptr_stream->size > (uint32_t)UINT16_MAX) ||
+           ((ptr_stream->size & (ptr_stream->size - 1U)) != 0U)) {
+          // Free running head modulo size is continuous over 2^32 wrap only if size is a power of 2
+          return ARM_DRIVER_ERROR_PARAMETER;
+        }
+        if (ptr_ro_info->ptr_rw_info->reg_file != NULL) {
+          // Register file emulation and receive stream cannot be used at the same time
+          return ARM_DRIVER_ERROR;
+        }
+        ptr_stream->head     = 0U;
+        ptr_stream->tail     = 0U;
+        ptr_stream->xfer_num = 0U;
+      }
+
+      primask = __get_PRIMASK();
+      __disable_irq();
+
+      ptr_ro_info->ptr_rw_info->stream         = ptr_stream;
+      ptr_ro_info->ptr_rw_info->stream_active  = 0U;
+      ptr_ro_info->ptr_rw_info->stream_seg_num = 0U;
+
+      __set_PRIMASK(primask);
+      break;
+
     default:
       return ARM_DRIVER_ERROR;
   }
@@ -1604,7 +3181,10 @@ static ARM_I2C_STATUS I2Cn_GetStatus (const RO_Info_t * const ptr_ro_info) {
   *                   the configuration information for the specified I2C
   */
 void HAL_I2C_MasterTxCpltCallback (I2C_HandleTypeDef *hi2c) {
-  const RO_Info_t *ptr_ro_info;
+  const RO_Info_t        *ptr_ro_info;
+        uint8_t          *rx_data;
+        HAL_StatusTypeDef rx_status;
+        uint32_t          event;
 
   ptr_ro_info = I2C_GetInfo(hi2c);
 
@@ -1614,11 +3194,42 @@ void HAL_I2C_MasterTxCpltCallback (I2C_HandleTypeDef *hi2c) {
   if (ptr_ro_info->ptr_rw_info == NULL) {
     return;
   }
-  if (ptr_ro_info->ptr_rw_info->cb_event == NULL) {
+
+  event = I2Cn_XferContinue(ptr_ro_info, I2C_XFER_MASTER_TX);
+  if (event == 0U) {
+    // Next chunk of the transmit was started
     return;
   }
 
-  ptr_ro_info->ptr_rw_info->cb_event(ARM_I2C_EVENT_TRANSFER_DONE);
+  rx_data = ptr_ro_info->ptr_rw_info->master_xfer_rx_data;
+  if (rx_data != NULL) {                        // If receive follows the transmit
+    ptr_ro_info->ptr_rw_info->master_xfer_rx_data = NULL;
+    ptr_ro_info->ptr_rw_info->xfer_no_stop        = 0U;
+
+    if (event == ARM_I2C_EVENT_TRANSFER_DONE) {
+      // Start the reception with repeated START, it terminates the sequence with STOP
+      rx_status = I2Cn_XferStart(ptr_ro_info, I2C_XFER_MASTER_RX, ptr_ro_info->ptr_rw_info->master_xfer_saddr, rx_data, ptr_ro_info->ptr_rw_info->master_xfer_rx_num, I2C_OTHER_AND_LAST_FRAME);
+
+      if (rx_status == HAL_OK) {
+        // Transfer done is signaled when reception completes
+        return;
+      }
+
+      event = ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_TRANSFER_INCOMPLETE;
+    }
+  }
+
+  event |= I2Cn_SMBusFlags(ptr_ro_info);
+
+  if (I2Cn_QueueComplete(ptr_ro_info, event) == 0U) {
+    // If this was not a queued transfer
+    if (ptr_ro_info->ptr_rw_info->cb_event != NULL) {
+      ptr_ro_info->ptr_rw_info->cb_event(event);
+    }
+  }
+
+  // Start next queued transfer
+  I2Cn_QueueStartNext(ptr_ro_info);
 }
 
 /**
@@ -1629,6 +3240,7 @@ void HAL_I2C_MasterTxCpltCallback (I2C_HandleTypeDef *hi2c) {
   */
 void HAL_I2C_MasterRxCpltCallback (I2C_HandleTypeDef *hi2c) {
   const RO_Info_t *ptr_ro_info;
+        uint32_t   event;
 
   ptr_ro_info = I2C_GetInfo(hi2c);
 
@@ -1638,11 +3250,24 @@ void HAL_I2C_MasterRxCpltCallback (I2C_HandleTypeDef *hi2c) {
   if (ptr_ro_info->ptr_rw_info == NULL) {
     return;
   }
-  if (ptr_ro_info->ptr_rw_info->cb_event == NULL) {
+
+  event = I2Cn_XferContinue(ptr_ro_info, I2C_XFER_MASTER_RX);
+  if (event == 0U) {
+    // Next chunk of the reception was started
     return;
   }
 
-  ptr_ro_info->ptr_rw_info->cb_event(ARM_I2C_EVENT_TRANSFER_DONE);
+  event |= I2Cn_SMBusFlags(ptr_ro_info);
+
+  if (I2Cn_QueueComplete(ptr_ro_info, event) == 0U) {
+    // If this was not a queued transfer
+    if (ptr_ro_info->ptr_rw_info->cb_event != NULL) {
+      ptr_ro_info->ptr_rw_info->cb_event(event);
+    }
+  }
+
+  // Start next queued transfer
+  I2Cn_QueueStartNext(ptr_ro_info);
 }
 
 /**
@@ -1666,17 +3291,31 @@ void HAL_I2C_AddrCallback (I2C_HandleTypeDef *hi2c, uint8_t TransferDirection, u
     return;
   }
 
+  if (ptr_ro_info->ptr_rw_info->reg_file != NULL) {
+    // If Slave register file emulation is enabled, serve the access without application involvement
+    I2Cn_RegFileAddr(ptr_ro_info, TransferDirection);
+    return;
+  }
+
+  if (ptr_ro_info->ptr_rw_info->stream != NULL) {
+    // If Slave receive stream is enabled, repeated START ends the previous write transaction
+    I2Cn_StreamEnd(ptr_ro_info);
+
+    if (TransferDirection == I2C_DIRECTION_TRANSMIT) {
+      // Receive written data into the ring buffer without application involvement
+      ptr_ro_info->ptr_rw_info->stream_active   = 1U;
+      ptr_ro_info->ptr_rw_info->stream_xfer_num = 0U;
+      I2Cn_StreamArm(ptr_ro_info);
+      return;
+    }
+  }
+
   event = 0U;
 
   if (TransferDirection == I2C_DIRECTION_TRANSMIT) {            // If Master requests to send data to Slave
     if (ptr_ro_info->ptr_rw_info->slave_xfer_rx_data != NULL) { // If Slave operation was registered by SlaveReceive
       // Start the Slave reception
-      ptr_ro_info->ptr_rw_info->xfer_size = ptr_ro_info->ptr_rw_info->slave_xfer_rx_num;
-      if (ptr_ro_info->ptr_hi2c->hdmarx != NULL) {              // If DMA is used for Rx
-        (void)HAL_I2C_Slave_Seq_Receive_DMA(ptr_ro_info->ptr_hi2c, ptr_ro_info->ptr_rw_info->slave_xfer_rx_data, ptr_ro_info->ptr_rw_info->slave_xfer_rx_num, I2C_NEXT_FRAME);
-      } else {                                                  // If DMA is not configured (IRQ mode)
-        (void)HAL_I2C_Slave_Seq_Receive_IT (ptr_ro_info->ptr_hi2c, ptr_ro_info->ptr_rw_info->slave_xfer_rx_data, ptr_ro_info->ptr_rw_info->slave_xfer_rx_num, I2C_NEXT_FRAME);
-      }
+      (void)I2Cn_XferStart(ptr_ro_info, I2C_XFER_SLAVE_RX, 0U, ptr_ro_info->ptr_rw_info->slave_xfer_rx_data, ptr_ro_info->ptr_rw_info->slave_xfer_rx_num, I2C_NEXT_FRAME);
     } else {                                                    // If Slave operation was not registered by SlaveReceive
       event = ARM_I2C_EVENT_SLAVE_RECEIVE;
       ptr_ro_info->ptr_rw_info->i2c_direction = 1U;
@@ -1684,12 +3323,7 @@ void HAL_I2C_AddrCallback (I2C_HandleTypeDef *hi2c, uint8_t TransferDirection, u
   } else {                                                      // If Master requests to receive data from Slave
     if (ptr_ro_info->ptr_rw_info->slave_xfer_tx_data != NULL) { // If Slave operation was registered by SlaveTransmit
       // Start the Slave transmission
-      ptr_ro_info->ptr_rw_info->xfer_size = ptr_ro_info->ptr_rw_info->slave_xfer_tx_num;
-      if (ptr_ro_info->ptr_hi2c->hdmatx != NULL) {              // If DMA is used for Tx
-        (void)HAL_I2C_Slave_Seq_Transmit_DMA(ptr_ro_info->ptr_hi2c, (uint8_t *)(uint32_t)ptr_ro_info->ptr_rw_info->slave_xfer_tx_data, ptr_ro_info->ptr_rw_info->slave_xfer_tx_num, I2C_NEXT_FRAME);
-      } else {                                          // If DMA is not configured (IRQ mode)
-        (void)HAL_I2C_Slave_Seq_Transmit_IT (ptr_ro_info->ptr_hi2c, (uint8_t *)(uint32_t)ptr_ro_info->ptr_rw_info->slave_xfer_tx_data, ptr_ro_info->ptr_rw_info->slave_xfer_tx_num, I2C_NEXT_FRAME);
-      }
+      (void)I2Cn_XferStart(ptr_ro_info, I2C_XFER_SLAVE_TX, 0U, (uint8_t *)(uint32_t)ptr_ro_info->ptr_rw_info->slave_xfer_tx_data, ptr_ro_info->ptr_rw_info->slave_xfer_tx_num, I2C_NEXT_FRAME);
     } else {                                            // If Slave operation was not registered by SlaveTransmit
       event = ARM_I2C_EVENT_SLAVE_TRANSMIT;
       ptr_ro_info->ptr_rw_info->i2c_direction = 0U;
@@ -1725,6 +3359,7 @@ void HAL_I2C_AddrCallback (I2C_HandleTypeDef *hi2c, uint8_t TransferDirection, u
   */
 void HAL_I2C_SlaveTxCpltCallback (I2C_HandleTypeDef *hi2c) {
   const RO_Info_t *ptr_ro_info;
+        uint32_t   event;
 
   ptr_ro_info = I2C_GetInfo(hi2c);
 
@@ -1735,10 +3370,24 @@ void HAL_I2C_SlaveTxCpltCallback (I2C_HandleTypeDef *hi2c) {
     return;
   }
 
+  if (ptr_ro_info->ptr_rw_info->reg_state != I2C_REG_STATE_IDLE) {
+    // If Slave register file access is in progress, continue it
+    I2Cn_RegFileXferCplt(ptr_ro_info);
+    return;
+  }
+
+  event = I2Cn_XferContinue(ptr_ro_info, I2C_XFER_SLAVE_TX);
+  if (event == 0U) {
+    // Next chunk of the transmission was started
+    return;
+  }
+
   ptr_ro_info->ptr_rw_info->slave_xfer_tx_data = NULL;
 
+  event |= I2Cn_SMBusFlags(ptr_ro_info);
+
   if (ptr_ro_info->ptr_rw_info->cb_event != NULL) {
-    ptr_ro_info->ptr_rw_info->cb_event(ARM_I2C_EVENT_TRANSFER_DONE);
+    ptr_ro_info->ptr_rw_info->cb_event(event);
   }
 
   // Re-enable interrupts
@@ -1747,6 +3396,9 @@ void HAL_I2C_SlaveTxCpltCallback (I2C_HandleTypeDef *hi2c) {
 #else                                   // if this is I2C peripheral without TIMINGR register
   __HAL_I2C_ENABLE_IT(ptr_ro_info->ptr_hi2c, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR);
 #endif
+
+  // Start Master transfer queued while the peripheral was used as Slave
+  I2Cn_QueueStartNext(ptr_ro_info);
 }
 
 /**
@@ -1757,6 +3409,7 @@ void HAL_I2C_SlaveTxCpltCallback (I2C_HandleTypeDef *hi2c) {
   */
 void HAL_I2C_SlaveRxCpltCallback (I2C_HandleTypeDef *hi2c) {
   const RO_Info_t *ptr_ro_info;
+        uint32_t   event;
 
   ptr_ro_info = I2C_GetInfo(hi2c);
 
@@ -1767,10 +3420,32 @@ void HAL_I2C_SlaveRxCpltCallback (I2C_HandleTypeDef *hi2c) {
     return;
   }
 
+  if (ptr_ro_info->ptr_rw_info->reg_state != I2C_REG_STATE_IDLE) {
+    // If Slave register file access is in progress, continue it
+    I2Cn_RegFileXferCplt(ptr_ro_info);
+    return;
+  }
+
+  if (ptr_ro_info->ptr_rw_info->stream_active != 0U) {
+    // If end of ring buffer was reached, continue receiving from the start of ring buffer
+    ptr_ro_info->ptr_rw_info->stream->head    += ptr_ro_info->ptr_rw_info->stream_seg_num;
+    ptr_ro_info->ptr_rw_info->stream_xfer_num += ptr_ro_info->ptr_rw_info->stream_seg_num;
+    I2Cn_StreamArm(ptr_ro_info);
+    return;
+  }
+
+  event = I2Cn_XferContinue(ptr_ro_info, I2C_XFER_SLAVE_RX);
+  if (event == 0U) {
+    // Next chunk of the reception was started
+    return;
+  }
+
   ptr_ro_info->ptr_rw_info->slave_xfer_rx_data = NULL;
 
+  event |= I2Cn_SMBusFlags(ptr_ro_info);
+
   if (ptr_ro_info->ptr_rw_info->cb_event != NULL) {
-    ptr_ro_info->ptr_rw_info->cb_event(ARM_I2C_EVENT_TRANSFER_DONE);
+    ptr_ro_info->ptr_rw_info->cb_event(event);
   }
 
   // Re-enable interrupts
@@ -1779,6 +3454,9 @@ void HAL_I2C_SlaveRxCpltCallback (I2C_HandleTypeDef *hi2c) {
 #else                                   // if this is I2C peripheral without TIMINGR register
   __HAL_I2C_ENABLE_IT(ptr_ro_info->ptr_hi2c, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR);
 #endif
+
+  // Start Master transfer queued while the peripheral was used as Slave
+  I2Cn_QueueStartNext(ptr_ro_info);
 }
 
 /**
@@ -1789,6 +3467,7 @@ void HAL_I2C_SlaveRxCpltCallback (I2C_HandleTypeDef *hi2c) {
   */
 void HAL_I2C_ListenCpltCallback (I2C_HandleTypeDef *hi2c) {
   const RO_Info_t *ptr_ro_info;
+        uint32_t   event;
 
   ptr_ro_info = I2C_GetInfo(hi2c);
 
@@ -1798,6 +3477,26 @@ void HAL_I2C_ListenCpltCallback (I2C_HandleTypeDef *hi2c) {
 
   // Re-enable listen mode
   (void)HAL_I2C_EnableListen_IT(ptr_ro_info->ptr_hi2c);
+
+  if (ptr_ro_info->ptr_rw_info == NULL) {
+    return;
+  }
+
+  if (ptr_ro_info->ptr_rw_info->reg_file != NULL) {
+    // Slave register file access ended with STOP
+    I2Cn_RegFileStop(ptr_ro_info);
+  }
+
+  // Slave receive stream write transaction ended with STOP
+  I2Cn_StreamEnd(ptr_ro_info);
+
+  event = I2Cn_SMBusFlags(ptr_ro_info);
+  if ((event != 0U) && (ptr_ro_info->ptr_rw_info->cb_event != NULL)) {
+    ptr_ro_info->ptr_rw_info->cb_event(event);
+  }
+
+  // Start Master transfer queued while the peripheral was used as Slave
+  I2Cn_QueueStartNext(ptr_ro_info);
 }
 
 /**
@@ -1823,6 +3522,34 @@ void HAL_I2C_ErrorCallback (I2C_HandleTypeDef *hi2c) {
   error = HAL_I2C_GetError(hi2c);
   event = ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_TRANSFER_INCOMPLETE;
 
+  if (ptr_ro_info->ptr_rw_info->reg_state != I2C_REG_STATE_IDLE) {
+    // If Slave register file access was in progress, finish it
+    I2Cn_RegFileStop(ptr_ro_info);
+    if ((error & ~HAL_I2C_ERROR_AF) == 0U) {
+      // Master not acknowledging last read byte or ending write early is a regular end of access
+      return;
+    }
+  }
+
+  if (ptr_ro_info->ptr_rw_info->stream_active != 0U) {
+    // If Slave receive stream write transaction was in progress, finish it
+    I2Cn_StreamEnd(ptr_ro_info);
+    if ((error & ~HAL_I2C_ERROR_AF) == 0U) {
+      // Master ending write before end of ring buffer is a regular end of transaction
+      return;
+    }
+  }
+
+  // Discard remaining chunks of the transfer
+  ptr_ro_info->ptr_rw_info->xfer_rem = 0U;
+
+  event |= I2Cn_SMBusFlags(ptr_ro_info);
+
+  // Failed transfer ends the bus transaction, discard receive that would follow the transmit of
+  // Master transmit and receive and close the sequence of transfers without STOP
+  ptr_ro_info->ptr_rw_info->master_xfer_rx_data = NULL;
+  ptr_ro_info->ptr_rw_info->xfer_no_stop        = 0U;
+
   if ((error & HAL_I2C_ERROR_BERR) != 0U) {
     // Bus error
     event |= ARM_I2C_EVENT_BUS_ERROR;
@@ -1843,9 +3570,15 @@ void HAL_I2C_ErrorCallback (I2C_HandleTypeDef *hi2c) {
     }
   }
 
-  if (ptr_ro_info->ptr_rw_info->cb_event != NULL) {
-    ptr_ro_info->ptr_rw_info->cb_event(event);
+  if (I2Cn_QueueComplete(ptr_ro_info, event) == 0U) {
+    // If this was not a queued transfer
+    if (ptr_ro_info->ptr_rw_info->cb_event != NULL) {
+      ptr_ro_info->ptr_rw_info->cb_event(event);
+    }
   }
+
+  // Start next queued transfer
+  I2Cn_QueueStartNext(ptr_ro_info);
 }
 
 /**
@@ -1867,6 +3600,21 @@ void HAL_I2C_AbortCpltCallback (I2C_HandleTypeDef *hi2c) {
   }
 
   ptr_ro_info->ptr_rw_info->xfer_abort = 1U;
+  ptr_ro_info->ptr_rw_info->xfer_rem   = 0U;
+
+  // Complete aborted queued transfer
+  (void)I2Cn_QueueComplete(ptr_ro_info, ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_TRANSFER_INCOMPLETE);
+
+  if (ptr_ro_info->ptr_rw_info->xfer_abort_async != 0U) {
+    // If abort was started without blocking, signal its completion
+    ptr_ro_info->ptr_rw_info->xfer_abort_async = 0U;
+    if (ptr_ro_info->ptr_rw_info->cb_event != NULL) {
+      ptr_ro_info->ptr_rw_info->cb_event(I2C_STM32_EVENT_ABORT_DONE);
+    }
+  }
+
+  // Start next queued transfer
+  I2Cn_QueueStartNext(ptr_ro_info);
 }
 
 // Local driver functions definitions (for instances)
@@ -36,6 +36,76 @@ extern  "C"
 {
 #endif
 
+// Driver specific Control codes **********************************************
+// (values of the Control codes not used by the CMSIS-Driver I2C API)
+
+#define I2C_STM32_SET_BUS_SPEED_HZ      (0x80UL)        // Set Bus Speed; arg = SCL frequency (in Hz)
+#define I2C_STM32_MASTER_TRANSMIT_RECEIVE (0x81UL)      // Start Master transmit followed by receive with repeated START; arg = pointer to I2C_STM32_MASTER_XFER
+#define I2C_STM32_QUEUE_TRANSFER        (0x82UL)        // Queue Master transfer; arg = pointer to I2C_STM32_QUEUE_XFER
+#define I2C_STM32_ABORT_TRANSFER_ASYNC  (0x83UL)        // Abort transfer without blocking, completion is signaled with I2C_STM32_EVENT_ABORT_DONE; arg = max time to wait for completion (in us, 0 = do not wait)
+#define I2C_STM32_SET_SLAVE_REG_FILE    (0x84UL)        // Set Slave register file emulation; arg = pointer to I2C_STM32_SLAVE_REG_FILE (0 = disabled)
+#define I2C_STM32_SMBUS_PEC             (0x85UL)        // SMBus hardware PEC (Packet Error Checking) for Master transfers; arg: 0 = disabled, 1 = enabled
+#define I2C_STM32_SMBUS_ALERT           (0x86UL)        // SMBus Host SMBALERT detection; arg: 0 = disabled, 1 = enabled
+#define I2C_STM32_SMBUS_TIMEOUT         (0x87UL)        // SMBus timeouts; arg = TIMEOUTR register value (0 = disabled)
+#define I2C_STM32_SMBUS_CHECK_FLAGS     (0x88UL)        // Check SMBus flags and signal SMBus events; arg = 0 (ignored)
+#define I2C_STM32_SLAVE_RECEIVE_STREAM  (0x89UL)        // Set Slave receive streaming into ring buffer; arg = pointer to I2C_STM32_SLAVE_STREAM (0 = disabled)
+#define I2C_STM32_SET_MAX_DNF           (0x8AUL)        // Set Bus Speed with largest digital noise filter that meets SCL timing; arg = SCL frequency (in Hz)
+
+// Driver specific Events ******************************************************
+
+#define I2C_STM32_EVENT_ABORT_DONE      (1UL << 16)     // Transfer abort started with I2C_STM32_ABORT_TRANSFER_ASYNC completed
+#define I2C_STM32_EVENT_SLAVE_REG_WRITE (1UL << 17)     // Slave register file was written by Master (signaled after STOP)
+#define I2C_STM32_EVENT_SMBUS_PEC_ERROR (1UL << 18)     // SMBus received PEC did not match calculated PEC
+#define I2C_STM32_EVENT_SMBUS_ALERT     (1UL << 19)     // SMBus SMBALERT signal detected
+#define I2C_STM32_EVENT_SMBUS_TIMEOUT   (1UL << 20)     // SMBus timeout detected
+#define I2C_STM32_EVENT_SLAVE_STREAM_RECEIVE  (1UL << 21) // Slave receive stream write transaction ended (length in xfer_num of I2C_STM32_SLAVE_STREAM)
+#define I2C_STM32_EVENT_SLAVE_STREAM_OVERFLOW (1UL << 22) // Slave receive stream overwrote data not yet read by application
+
+// Master transmit and receive transfer description ***************************
+
+typedef struct {
+  uint32_t       addr;                  // Slave address (7-bit or 10-bit)
+  const uint8_t *tx_data;               // Pointer to buffer with data to transmit to I2C Slave
+  uint32_t       tx_num;                // Number of data bytes to transmit
+  uint8_t       *rx_data;               // Pointer to buffer for data to receive from I2C Slave
+  uint32_t       rx_num;                // Number of data bytes to receive
+} I2C_STM32_MASTER_XFER;
+
+// Slave register file *******************************************************
+
+typedef struct {
+  uint8_t                  *data;       // Pointer to register file memory
+  uint32_t                  size;       // Register file size in bytes: 1 .. 256
+  volatile uint32_t         wr_addr;    // Address of first register written by last write transaction (set by the driver)
+  volatile uint32_t         wr_num;     // Number of registers written by last write transaction (set by the driver)
+} I2C_STM32_SLAVE_REG_FILE;
+
+// Slave receive stream ******************************************************
+
+typedef struct {
+  uint8_t                  *data;       // Pointer to ring buffer memory
+  uint32_t                  size;       // Ring buffer size in bytes: power of 2, 1 .. 32768
+  volatile uint32_t         head;       // Number of bytes written to ring buffer (set by the driver, wraps at 2^32)
+  volatile uint32_t         tail;       // Number of bytes read from ring buffer (set by the application, wraps at 2^32)
+  volatile uint32_t         xfer_num;   // Number of bytes received by last write transaction (set by the driver)
+} I2C_STM32_SLAVE_STREAM;
+
+// Queued Master transfer *****************************************************
+
+typedef struct _I2C_STM32_QUEUE_XFER I2C_STM32_QUEUE_XFER;
+
+// Queued Master transfer completion callback function type
+typedef void (*I2C_STM32_QueueCallback_t) (I2C_STM32_QUEUE_XFER *qxfer, uint32_t event);
+
+struct _I2C_STM32_QUEUE_XFER {
+  I2C_STM32_MASTER_XFER     xfer;       // Transfer description (tx_num = 0: receive only, rx_num = 0: transmit only)
+  uint32_t                  priority;   // Priority: 0 = highest, transfers with same priority are started in queuing order
+  I2C_STM32_QueueCallback_t cb_xfer;    // Transfer completion callback (NULL = not used)
+  void                     *user_data;  // User data (not used by the driver)
+  volatile uint32_t         event;      // Transfer completion events (ARM_I2C_EVENT_xxx), 0 while transfer is queued or in progress
+  I2C_STM32_QUEUE_XFER     *next;       // Reserved (used by the driver)
+};
+
 // Global driver structures ****************************************************
 
 #ifdef  MX_I2C1
@@ -0,0 +1,1078 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * $Date:       18. October 2026
+ * $Revision:   V1.0
+ *
+ * Project:     OCTOSPI/QUADSPI Driver for STMicroelectronics STM32 devices
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*! \page ospi_stm32 OSPI
+
+# Revision History
+
+- Version 1.0
+  - Initial release
+
+# Requirements
+
+This driver requires the STM32 device specific **HAL** and **STM32CubeMX** (CubeMX) initialization code generator.
+The driver instance is mapped to hardware as shown in the table below:
+
+  Driver Instance       | STM32 Hardware Resource
+  :---------------------|:-----------------------
+  Driver_OSPI1          | OCTOSPI1 or QUADSPI
+  Driver_OSPI2          | OCTOSPI2
+
+# Driver API
+
+CMSIS-Driver specification does not define an interface for Octo-SPI and Quad-SPI memory controllers,
+so this driver provides its own interface (**OSPI_STM32_DRIVER**) defined in the **OSPI_STM32.h** header file.
+The interface follows the CMSIS-Driver concepts (Initialize, PowerControl, Control, GetStatus, event callback):
+  - **Command**: sends a command without data phase (for example Write Enable or Sector Erase),
+    completion is signaled with event **OSPI_STM32_EVENT_TRANSFER_COMPLETE**
+  - **Read** and **Write**: send a command and transfer data in indirect mode, using **DMA** if it is configured
+    for the peripheral in CubeMX or interrupts otherwise, completion is signaled with event **OSPI_STM32_EVENT_TRANSFER_COMPLETE**
+  - **MemoryMapped**: enters memory-mapped mode with specified read (and optional write) command, in which the external memory
+    is accessible in the device address space (for example for execute-in-place), called with read command NULL it exits memory-mapped mode
+  - **GetDataCount**: returns number of data bytes transferred by the last Read or Write request
+  - **Control**: **OSPI_STM32_ABORT_TRANSFER** aborts the current transfer (or memory-mapped mode),
+    **OSPI_STM32_SET_MMAP_TIMEOUT** sets the number of clock cycles after which chip select is released in memory-mapped mode
+    when there is no access
+
+Each phase of a command is described by the **OSPI_STM32_COMMAND** structure:
+  - instruction, address and alternate bytes phases are enabled by specifying number of lines (1, 2, 4 or 8) and size in bytes
+  - data phase lines are specified with **data_lines**, dummy cycles with **dummy_cycles**
+  - double transfer rate (DTR) is selected per phase with **OSPI_STM32_DTR_xxx** flags in **dtr** and
+    data strobe with **dqs** (for example octal DTR read of Macronix Octaflash or Micron Xccela flash)
+
+> **Notes**
+>
+> - on **QUADSPI** peripheral, only 1, 2 or 4 lines and 1 byte instruction are supported, DTR mode is selected for address,
+>   alternate bytes and data phases together (instruction phase is always single transfer rate) and data strobe is not available.
+> - memory-mapped region starts at the address defined by the device header (for example **OCTOSPI1_BASE** or **QSPI_BASE**).
+> - on **QUADSPI** peripheral memory-mapped mode is read only.
+> - **Read**, **Write** and **Command** functions return **ARM_DRIVER_ERROR_BUSY** while memory-mapped mode is active.
+> - maximum number of bytes in a single **Read** or **Write** request can be limited by the DMA controller used
+>   (refer to the device reference manual).
+
+# CubeMX Configuration
+
+This driver requires the following configuration in CubeMX:
+
+  - **clock**: **OCTOSPI** or **QUADSPI** peripheral clock.
+  - **peripheral**: **OCTOSPI** or **QUADSPI** peripheral configured as required by the external memory
+    (memory type, device size, chip select high time, clock prescaler, ...).
+  - **pins**: **CLK**, **NCS** and **IO** pins (and **DQS** pin if used).
+  - **DMA**: optional **DMA** configuration for indirect mode transfers.
+  - **interrupts**: enabled **OCTOSPI** or **QUADSPI global interrupt** and **IRQ handlers** that **Call HAL handlers** and
+    enabled **DMA interrupts** and **IRQ handlers** that **Call HAL handlers** if **DMA** is used.
+
+> **Notes**
+>
+> - configuration information in the **MX_Device.h** file is based on CubeMX configuration.
+> - **DMA** configuration can differ between devices series so configure DMA **as required by the used device**.
+> - for **DMA** usage on devices with cache, ensure that data buffers for Read and Write functions
+>   are in **non-cacheable memory**, or ensure that memory for write is updated (**cache clean**) before Write function
+>   is called and that memory containing read data is updated after the reception finishes (**cache invalidate**).
+> - in memory-mapped mode data read from the external memory is cached if the memory region is cacheable,
+>   so after the memory content was changed in indirect mode invalidate the cache for the memory-mapped region.
+*/
+
+/*! \cond */
+
+#include "OSPI_STM32.h"
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+
+#include <string.h>
+
+// Driver Version **************************************************************
+                                                //  OSPI API version       , Driver version
+static  const ARM_DRIVER_VERSION driver_version = { OSPI_STM32_API_VERSION , ARM_DRIVER_VERSION_MAJOR_MINOR(1,0) };
+// *****************************************************************************
+
+// Compile-time configuration **************************************************
+
+// Configuration depending on MX_Device.h
+
+// Check if at least one peripheral instance is configured in STM32CubeMX
+#if    (!defined(MX_OCTOSPI1) && \
+        !defined(MX_OCTOSPI2) && \
+        !defined(MX_QUADSPI))
+#error  OSPI driver requires at least one OCTOSPI or QUADSPI peripheral configured in STM32CubeMX!
+
+// Check if MX_Device.h version is as required (old version did not have all the necessary information)
+#elif  (!defined(MX_DEVICE_VERSION) || (MX_DEVICE_VERSION < 0x01000000U))
+#error  OSPI driver requires new MX_Device.h configuration, please regenerate MX_Device.h file!
+
+// Check that QUADSPI and OCTOSPI are not both configured (driver instance 1 is used for both)
+#elif   defined(MX_QUADSPI) && (defined(MX_OCTOSPI1) || defined(MX_OCTOSPI2))
+#error  OSPI driver does not support QUADSPI and OCTOSPI peripherals configured at the same time!
+
+#else
+#define DRIVER_CONFIG_VALID     1
+#endif
+
+// Determine peripheral/HAL differences that driver needs to handle
+
+// Determine if peripheral is QUADSPI (HAL QSPI module) instead of OCTOSPI (HAL OSPI module)
+
+#ifdef  MX_QUADSPI
+#define OSPI_VARIANT_QUADSPI            1
+#endif
+
+// *****************************************************************************
+
+#ifdef  DRIVER_CONFIG_VALID     // Driver code is available only if configuration is valid
+
+// HAL module abstraction
+#ifdef  OSPI_VARIANT_QUADSPI
+typedef QSPI_HandleTypeDef              OSPI_Handle_t;
+typedef QSPI_CommandTypeDef             OSPI_Command_t;
+typedef QSPI_MemoryMappedTypeDef        OSPI_MemoryMapped_t;
+#define OSPI_HAL_ERROR_NONE             HAL_QSPI_ERROR_NONE
+#define OSPI_HAL_Init                   HAL_QSPI_Init
+#define OSPI_HAL_DeInit                 HAL_QSPI_DeInit
+#define OSPI_HAL_Command                HAL_QSPI_Command
+#define OSPI_HAL_Command_IT             HAL_QSPI_Command_IT
+#define OSPI_HAL_Transmit_DMA           HAL_QSPI_Transmit_DMA
+#define OSPI_HAL_Receive_DMA            HAL_QSPI_Receive_DMA
+#define OSPI_HAL_Transmit_IT            HAL_QSPI_Transmit_IT
+#define OSPI_HAL_Receive_IT             HAL_QSPI_Receive_IT
+#define OSPI_HAL_Abort                  HAL_QSPI_Abort
+#define OSPI_HAL_GetError               HAL_QSPI_GetError
+#else
+typedef OSPI_HandleTypeDef              OSPI_Handle_t;
+typedef OSPI_RegularCmdTypeDef          OSPI_Command_t;
+typedef OSPI_MemoryMappedTypeDef        OSPI_MemoryMapped_t;
+#define OSPI_HAL_ERROR_NONE             HAL_OSPI_ERROR_NONE
+#define OSPI_HAL_Init                   HAL_OSPI_Init
+#define OSPI_HAL_DeInit                 HAL_OSPI_DeInit
+#define OSPI_HAL_Command                HAL_OSPI_Command
+#define OSPI_HAL_Command_IT             HAL_OSPI_Command_IT
+#define OSPI_HAL_Transmit_DMA           HAL_OSPI_Transmit_DMA
+#define OSPI_HAL_Receive_DMA            HAL_OSPI_Receive_DMA
+#define OSPI_HAL_Transmit_IT            HAL_OSPI_Transmit_IT
+#define OSPI_HAL_Receive_IT             HAL_OSPI_Receive_IT
+#define OSPI_HAL_Abort                  HAL_OSPI_Abort
+#define OSPI_HAL_GetError               HAL_OSPI_GetError
+#endif
+
+// Macros
+// Macro for section for RW info
+#ifdef  OSPI_SECTION_NAME
+#define OSPIn_SECTION_(name,n)  __attribute__((section(name #n)))
+#define OSPIn_SECTION(n)        OSPIn_SECTION_(OSPI_SECTION_NAME,n)
+#else
+#define OSPIn_SECTION(n)
+#endif
+
+// Macro to create ospi_ro_info and ospi_rw_info (for instances)
+#define INFO_DEFINE(n,h)                                                                                       \
+extern  OSPI_Handle_t           h;                                                                             \
+static        RW_Info_t         ospi##n##_rw_info OSPIn_SECTION(n);                                            \
+static  const RO_Info_t         ospi##n##_ro_info   = { &h,                                                    \
+                                                        &ospi##n##_rw_info                                     \
+                                                      };
+
+// Macro for declaring functions (for instances)
+#define FUNCS_DECLARE(n)                                                                                                                \
+static  int32_t                 OSPI##n##_Initialize      (OSPI_STM32_SignalEvent_t cb_event);                                          \
+static  int32_t                 OSPI##n##_Uninitialize    (void);                                                                       \
+static  int32_t                 OSPI##n##_PowerControl    (ARM_POWER_STATE state);                                                      \
+static  int32_t                 OSPI##n##_Command         (const OSPI_STM32_COMMAND *cmd);                                              \
+static  int32_t                 OSPI##n##_Read            (const OSPI_STM32_COMMAND *cmd,       void *data, uint32_t num);              \
+static  int32_t                 OSPI##n##_Write           (const OSPI_STM32_COMMAND *cmd, const void *data, uint32_t num);              \
+static  int32_t                 OSPI##n##_MemoryMapped    (const OSPI_STM32_COMMAND *read_cmd, const OSPI_STM32_COMMAND *write_cmd);    \
+static  uint32_t                OSPI##n##_GetDataCount    (void);                                                                       \
+static  int32_t                 OSPI##n##_Control         (uint32_t control, uint32_t arg);                                             \
+static  OSPI_STM32_STATUS       OSPI##n##_GetStatus       (void);
+
+// Macro for defining functions (for instances)
+#define FUNCS_DEFINE(n)                                                                                                                                                                                          \
+static  int32_t                 OSPI##n##_Initialize      (OSPI_STM32_SignalEvent_t cb_event)                                         { return OSPIn_Initialize  (&ospi##n##_ro_info, cb_event); }             \
+static  int32_t                 OSPI##n##_Uninitialize    (void)                                                                      { return OSPIn_Uninitialize(&ospi##n##_ro_info); }                       \
+static  int32_t                 OSPI##n##_PowerControl    (ARM_POWER_STATE state)                                                     { return OSPIn_PowerControl(&ospi##n##_ro_info, state); }                \
+static  int32_t                 OSPI##n##_Command         (const OSPI_STM32_COMMAND *cmd)                                             { return OSPIn_Command     (&ospi##n##_ro_info, cmd); }                  \
+static  int32_t                 OSPI##n##_Read            (const OSPI_STM32_COMMAND *cmd,       void *data, uint32_t num)             { return OSPIn_Read        (&ospi##n##_ro_info, cmd, data, num); }       \
+static  int32_t                 OSPI##n##_Write           (const OSPI_STM32_COMMAND *cmd, const void *data, uint32_t num)             { return OSPIn_Write       (&ospi##n##_ro_info, cmd, data, num); }       \
+static  int32_t                 OSPI##n##_MemoryMapped    (const OSPI_STM32_COMMAND *read_cmd, const OSPI_STM32_COMMAND *write_cmd)   { return OSPIn_MemoryMapped(&ospi##n##_ro_info, read_cmd, write_cmd); }  \
+static  uint32_t                OSPI##n##_GetDataCount    (void)                                                                      { return OSPIn_GetDataCount(&ospi##n##_ro_info); }                       \
+static  int32_t                 OSPI##n##_Control         (uint32_t control, uint32_t arg)                                            { return OSPIn_Control     (&ospi##n##_ro_info, control, arg); }         \
+static  OSPI_STM32_STATUS       OSPI##n##_GetStatus       (void)                                                                      { return OSPIn_GetStatus   (&ospi##n##_ro_info); }
+
+// Macro for defining driver structures (for instances)
+#define OSPI_DRIVER(n)                  \
+OSPI_STM32_DRIVER Driver_OSPI##n = {    \
+  OSPI_GetVersion,                      \
+  OSPI##n##_Initialize,                 \
+  OSPI##n##_Uninitialize,               \
+  OSPI##n##_PowerControl,               \
+  OSPI##n##_Command,                    \
+  OSPI##n##_Read,                       \
+  OSPI##n##_Write,                      \
+  OSPI##n##_MemoryMapped,               \
+  OSPI##n##_GetDataCount,               \
+  OSPI##n##_Control,                    \
+  OSPI##n##_GetStatus                   \
+};
+
+// Command phase timeout definition
+#ifndef OSPI_COMMAND_TIMEOUT
+#define OSPI_COMMAND_TIMEOUT           (100U)           // Timeout for sending command phases preceding data (in ms)
+#endif
+
+// Number of supported line settings (0, 1, 2, 4 and on OCTOSPI also 8 lines)
+#ifdef  OSPI_VARIANT_QUADSPI
+#define OSPI_LINES_NUM                 (4U)
+#else
+#define OSPI_LINES_NUM                 (5U)
+#endif
+
+// Maximum memory-mapped mode timeout (in clock cycles)
+#define OSPI_MMAP_TIMEOUT_MAX          (0xFFFFU)
+
+// Driver status
+typedef struct {
+  uint32_t                      initialized  : 1;       // Initialized status: 0 - not initialized, 1 - initialized
+  uint32_t                      powered      : 1;       // Power status:       0 - not powered,     1 - powered
+  uint32_t                      reserved     : 30;      // Reserved (for padding)
+} DriverStatus_t;
+
+// Instance run-time information (RW)
+typedef struct {
+  OSPI_STM32_SignalEvent_t      cb_event;               // Event callback
+  DriverStatus_t                drv_status;             // Driver status
+  uint32_t                      mmap_timeout;           // Memory-mapped mode timeout (in clock cycles, 0 - disabled)
+  uint32_t                      xfer_num;               // Number of data bytes requested by last Read or Write (0 - last request was Command)
+  volatile uint8_t              xfer_active;            // Command or data transfer active: 0 - inactive, 1 - active
+  volatile uint8_t              mem_mapped;             // Memory-mapped mode: 0 - inactive, 1 - active
+} RW_Info_t;
+
+// Instance compile-time information (RO)
+// also contains pointer to run-time information
+typedef struct {
+        OSPI_Handle_t          *ptr_hospi;              // Pointer to OSPI (or QSPI) handle
+        RW_Info_t              *ptr_rw_info;            // Pointer to run-time information (RW)
+} RO_Info_t;
+
+// Information definitions (for instances)
+#ifdef MX_QUADSPI
+INFO_DEFINE(1, hqspi)
+#endif
+#ifdef MX_OCTOSPI1
+INFO_DEFINE(1, hospi1)
+#endif
+#ifdef MX_OCTOSPI2
+INFO_DEFINE(2, hospi2)
+#endif
+
+// List of available OSPI instance infos
+static const RO_Info_t * const ospi_ro_info_list[] = {
+#if defined(MX_OCTOSPI1) || defined(MX_QUADSPI)
+  &ospi1_ro_info,
+#endif
+#ifdef MX_OCTOSPI2
+  &ospi2_ro_info,
+#endif
+  NULL
+};
+
+// HAL settings for number of lines of each phase, index is determined by OSPI_GetLinesIndex
+#ifdef  OSPI_VARIANT_QUADSPI
+static const uint32_t ospi_instruction_mode[OSPI_LINES_NUM] = {
+  QSPI_INSTRUCTION_NONE,     QSPI_INSTRUCTION_1_LINE,     QSPI_INSTRUCTION_2_LINES,     QSPI_INSTRUCTION_4_LINES
+};
+static const uint32_t ospi_address_mode    [OSPI_LINES_NUM] = {
+  QSPI_ADDRESS_NONE,         QSPI_ADDRESS_1_LINE,         QSPI_ADDRESS_2_LINES,         QSPI_ADDRESS_4_LINES
+};
+static const uint32_t ospi_alt_bytes_mode  [OSPI_LINES_NUM] = {
+  QSPI_ALTERNATE_BYTES_NONE, QSPI_ALTERNATE_BYTES_1_LINE, QSPI_ALTERNATE_BYTES_2_LINES, QSPI_ALTERNATE_BYTES_4_LINES
+};
+static const uint32_t ospi_data_mode       [OSPI_LINES_NUM] = {
+  QSPI_DATA_NONE,            QSPI_DATA_1_LINE,            QSPI_DATA_2_LINES,            QSPI_DATA_4_LINES
+};
+#else
+static const uint32_t ospi_instruction_mode[OSPI_LINES_NUM] = {
+  HAL_OSPI_INSTRUCTION_NONE,     HAL_OSPI_INSTRUCTION_1_LINE,     HAL_OSPI_INSTRUCTION_2_LINES,     HAL_OSPI_INSTRUCTION_4_LINES,     HAL_OSPI_INSTRUCTION_8_LINES
+};
+static const uint32_t ospi_address_mode    [OSPI_LINES_NUM] = {
+  HAL_OSPI_ADDRESS_NONE,         HAL_OSPI_ADDRESS_1_LINE,         HAL_OSPI_ADDRESS_2_LINES,         HAL_OSPI_ADDRESS_4_LINES,         HAL_OSPI_ADDRESS_8_LINES
+};
+static const uint32_t ospi_alt_bytes_mode  [OSPI_LINES_NUM] = {
+  HAL_OSPI_ALTERNATE_BYTES_NONE, HAL_OSPI_ALTERNATE_BYTES_1_LINE, HAL_OSPI_ALTERNATE_BYTES_2_LINES, HAL_OSPI_ALTERNATE_BYTES_4_LINES, HAL_OSPI_ALTERNATE_BYTES_8_LINES
+};
+static const uint32_t ospi_data_mode       [OSPI_LINES_NUM] = {
+  HAL_OSPI_DATA_NONE,            HAL_OSPI_DATA_1_LINE,            HAL_OSPI_DATA_2_LINES,            HAL_OSPI_DATA_4_LINES,            HAL_OSPI_DATA_8_LINES
+};
+#endif
+
+// HAL settings for size of each phase, index is size in bytes - 1
+#ifdef  OSPI_VARIANT_QUADSPI
+static const uint32_t ospi_address_size    [4] = {
+  QSPI_ADDRESS_8_BITS,         QSPI_ADDRESS_16_BITS,         QSPI_ADDRESS_24_BITS,         QSPI_ADDRESS_32_BITS
+};
+static const uint32_t ospi_alt_bytes_size  [4] = {
+  QSPI_ALTERNATE_BYTES_8_BITS, QSPI_ALTERNATE_BYTES_16_BITS, QSPI_ALTERNATE_BYTES_24_BITS, QSPI_ALTERNATE_BYTES_32_BITS
+};
+#else
+static const uint32_t ospi_instruction_size[4] = {
+  HAL_OSPI_INSTRUCTION_8_BITS,     HAL_OSPI_INSTRUCTION_16_BITS,     HAL_OSPI_INSTRUCTION_24_BITS,     HAL_OSPI_INSTRUCTION_32_BITS
+};
+static const uint32_t ospi_address_size    [4] = {
+  HAL_OSPI_ADDRESS_8_BITS,         HAL_OSPI_ADDRESS_16_BITS,         HAL_OSPI_ADDRESS_24_BITS,         HAL_OSPI_ADDRESS_32_BITS
+};
+static const uint32_t ospi_alt_bytes_size  [4] = {
+  HAL_OSPI_ALTERNATE_BYTES_8_BITS, HAL_OSPI_ALTERNATE_BYTES_16_BITS, HAL_OSPI_ALTERNATE_BYTES_24_BITS, HAL_OSPI_ALTERNATE_BYTES_32_BITS
+};
+#endif
+
+// Local functions prototypes
+static const RO_Info_t         *OSPI_GetInfo         (const OSPI_Handle_t * const hospi);
+static uint32_t                 OSPI_GetLinesIndex   (uint8_t lines);
+static int32_t                  OSPI_SetupCommand    (const OSPI_STM32_COMMAND *cmd, uint8_t data_phase, uint32_t num, OSPI_Command_t *ptr_hal_cmd);
+static int32_t                  OSPI_ConvertStatus   (HAL_StatusTypeDef hal_status);
+static void                     OSPI_SignalEvent     (const OSPI_Handle_t * const hospi, uint32_t event);
+static ARM_DRIVER_VERSION       OSPI_GetVersion      (void);
+static int32_t                  OSPIn_Initialize     (const RO_Info_t * const ptr_ro_info, OSPI_STM32_SignalEvent_t cb_event);
+static int32_t                  OSPIn_Uninitialize   (const RO_Info_t * const ptr_ro_info);
+static int32_t                  OSPIn_PowerControl   (const RO_Info_t * const ptr_ro_info, ARM_POWER_STATE state);
+static int32_t                  OSPIn_Command        (const RO_Info_t * const ptr_ro_info, const OSPI_STM32_COMMAND *cmd);
+static int32_t                  OSPIn_Read           (const RO_Info_t * const ptr_ro_info, const OSPI_STM32_COMMAND *cmd,       void *data, uint32_t num);
+static int32_t                  OSPIn_Write          (const RO_Info_t * const ptr_ro_info, const OSPI_STM32_COMMAND *cmd, const void *data, uint32_t num);
+static int32_t                  OSPIn_MemoryMapped   (const RO_Info_t * const ptr_ro_info, const OSPI_STM32_COMMAND *read_cmd, const OSPI_STM32_COMMAND *write_cmd);
+static uint32_t                 OSPIn_GetDataCount   (const RO_Info_t * const ptr_ro_info);
+static int32_t                  OSPIn_Control        (const RO_Info_t * const ptr_ro_info, uint32_t control, uint32_t arg);
+static OSPI_STM32_STATUS        OSPIn_GetStatus      (const RO_Info_t * const ptr_ro_info);
+
+// Local driver functions declarations (for instances)
+#if defined(MX_OCTOSPI1) || defined(MX_QUADSPI)
+FUNCS_DECLARE(1)
+#endif
+#ifdef MX_OCTOSPI2
+FUNCS_DECLARE(2)
+#endif
+
+// Auxiliary functions
+
+/**
+  \fn          RO_Info_t *OSPI_GetInfo (const OSPI_Handle_t * const hospi)
+  \brief       Get pointer to RO_Info_t structure corresponding to specified hospi.
+  \param[in]   hospi    Pointer to OSPI (or QSPI) handle structure
+  \return      pointer to OSPI RO info structure (RO_Info_t)
+*/
+static const RO_Info_t *OSPI_GetInfo (const OSPI_Handle_t * const hospi) {
+  const RO_Info_t *ptr_ro_info;
+        uint8_t    i;
+
+  ptr_ro_info = NULL;
+  i            = 0U;
+
+  // Find OSPI which uses same hospi handle as parameter hospi
+  for (i = 0U; i < (sizeof(ospi_ro_info_list)/sizeof(RO_Info_t *)); i++) {
+    if (ospi_ro_info_list[i] != NULL) {
+      if (ospi_ro_info_list[i]->ptr_hospi == hospi) {
+        ptr_ro_info = ospi_ro_info_list[i];
+        break;
+      }
+    }
+  }
+
+  return ptr_ro_info;
+}
+
+/**
+  \fn          uint32_t OSPI_GetLinesIndex (uint8_t lines)
+  \brief       Get index into HAL line settings tables for specified number of lines.
+  \param[in]   lines    Number of lines (0, 1, 2, 4 or 8)
+  \return      index into HAL line settings tables (>= OSPI_LINES_NUM - if number of lines is not supported,
+               for example 8 lines on QUADSPI)
+*/
+static uint32_t OSPI_GetLinesIndex (uint8_t lines) {
+  uint32_t idx;
+
+  switch (lines) {
+    case 0U:  idx = 0U;             break;
+    case 1U:  idx = 1U;             break;
+    case 2U:  idx = 2U;             break;
+    case 4U:  idx = 3U;             break;
+    case 8U:  idx = 4U;             break;
+    default:  idx = OSPI_LINES_NUM; break;
+  }
+
+  return idx;
+}
+
+/**
+  \fn          int32_t OSPI_SetupCommand (const OSPI_STM32_COMMAND *cmd, uint8_t data_phase, uint32_t num, OSPI_Command_t *ptr_hal_cmd)
+  \brief       Convert command description to HAL command structure.
+  \param[in]   cmd             Pointer to command description
+  \param[in]   data_phase      Data phase: 0 - without data phase, 1 - with data phase
+  \param[in]   num             Number of data bytes (0 in memory-mapped mode)
+  \param[out]  ptr_hal_cmd     Pointer to HAL command structure
+  \return      \ref execution_status
+*/
+static int32_t OSPI_SetupCommand (const OSPI_STM32_COMMAND *cmd, uint8_t data_phase, uint32_t num, OSPI_Command_t *ptr_hal_cmd) {
+  uint32_t instr_idx, addr_idx, alt_idx, data_idx;
+  uint32_t addr_size_idx, alt_size_idx;
+#ifndef OSPI_VARIANT_QUADSPI
+  uint32_t instr_size_idx;
+#endif
+
+  instr_idx = OSPI_GetLinesIndex(cmd->instruction_lines);
+  addr_idx  = OSPI_GetLinesIndex(cmd->address_lines);
+  alt_idx   = OSPI_GetLinesIndex(cmd->alt_bytes_lines);
+  data_idx  = 0U;
+  if (data_phase != 0U) {
+    data_idx = OSPI_GetLinesIndex(cmd->data_lines);
+    if (data_idx == 0U) {
+      // Data phase requires at least 1 line
+      return ARM_DRIVER_ERROR_PARAMETER;
+    }
+  }
+  if ((instr_idx >= OSPI_LINES_NUM) || (addr_idx >= OSPI_LINES_NUM) ||
+      (alt_idx   >= OSPI_LINES_NUM) || (data_idx >= OSPI_LINES_NUM)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  // Phase sizes are only relevant for enabled phases (index is size in bytes - 1)
+  addr_size_idx = (addr_idx != 0U) ? ((uint32_t)cmd->address_size   - 1U) : 0U;
+  alt_size_idx  = (alt_idx  != 0U) ? ((uint32_t)cmd->alt_bytes_size - 1U) : 0U;
+  if ((addr_size_idx >= 4U) || (alt_size_idx >= 4U) || (cmd->dummy_cycles > 31U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  memset(ptr_hal_cmd, 0, sizeof(OSPI_Command_t));
+
+#ifdef OSPI_VARIANT_QUADSPI
+  if ((instr_idx != 0U) && (cmd->instruction_size != 1U)) {
+    // Only 1 byte instruction is supported
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if ((cmd->dtr & OSPI_STM32_DTR_INSTRUCTION) != 0U) {
+    // Instruction is always sent in single transfer rate mode
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  ptr_hal_cmd->Instruction        = cmd->instruction;
+  ptr_hal_cmd->InstructionMode    = ospi_instruction_mode[instr_idx];
+  ptr_hal_cmd->Address            = cmd->address;
+  ptr_hal_cmd->AddressMode        = ospi_address_mode[addr_idx];
+  ptr_hal_cmd->AddressSize        = ospi_address_size[addr_size_idx];
+  ptr_hal_cmd->AlternateBytes     = cmd->alt_bytes;
+  ptr_hal_cmd->AlternateByteMode  = ospi_alt_bytes_mode[alt_idx];
+  ptr_hal_cmd->AlternateBytesSize = ospi_alt_bytes_size[alt_size_idx];
+  ptr_hal_cmd->DataMode           = ospi_data_mode[data_idx];
+  ptr_hal_cmd->NbData             = num;
+  ptr_hal_cmd->DummyCycles        = cmd->dummy_cycles;
+  ptr_hal_cmd->DdrMode            = (cmd->dtr != 0U) ? QSPI_DDR_MODE_ENABLE : QSPI_DDR_MODE_DISABLE;
+  ptr_hal_cmd->DdrHoldHalfCycle   = QSPI_DDR_HHC_ANALOG_DELAY;
+  ptr_hal_cmd->SIOOMode           = QSPI_SIOO_INST_EVERY_CMD;
+#else
+  instr_size_idx = (instr_idx != 0U) ? ((uint32_t)cmd->instruction_size - 1U) : 0U;
+  if (instr_size_idx >= 4U) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  ptr_hal_cmd->OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  ptr_hal_cmd->FlashId               = HAL_OSPI_FLASH_ID_1;
+  ptr_hal_cmd->Instruction           = cmd->instruction;
+  ptr_hal_cmd->InstructionMode       = ospi_instruction_mode[instr_idx];
+  ptr_hal_cmd->InstructionSize       = ospi_instruction_size[instr_size_idx];
+  ptr_hal_cmd->InstructionDtrMode    = ((cmd->dtr & OSPI_STM32_DTR_INSTRUCTION) != 0U) ? HAL_OSPI_INSTRUCTION_DTR_ENABLE     : HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+  ptr_hal_cmd->Address               = cmd->address;
+  ptr_hal_cmd->AddressMode           = ospi_address_mode[addr_idx];
+  ptr_hal_cmd->AddressSize           = ospi_address_size[addr_size_idx];
+  ptr_hal_cmd->AddressDtrMode        = ((cmd->dtr & OSPI_STM32_DTR_ADDRESS)     != 0U) ? HAL_OSPI_ADDRESS_DTR_ENABLE         : HAL_OSPI_ADDRESS_DTR_DISABLE;
+  ptr_hal_cmd->AlternateBytes        = cmd->alt_bytes;
+  ptr_hal_cmd->AlternateBytesMode    = ospi_alt_bytes_mode[alt_idx];
+  ptr_hal_cmd->AlternateBytesSize    = ospi_alt_bytes_size[alt_size_idx];
+  ptr_hal_cmd->AlternateBytesDtrMode = ((cmd->dtr & OSPI_STM32_DTR_ALT_BYTES)   != 0U) ? HAL_OSPI_ALTERNATE_BYTES_DTR_ENABLE : HAL_OSPI_ALTERNATE_BYTES_DTR_DISABLE;
+  ptr_hal_cmd->DataMode              = ospi_data_mode[data_idx];
+  ptr_hal_cmd->NbData                = num;
+  ptr_hal_cmd->DataDtrMode           = ((cmd->dtr & OSPI_STM32_DTR_DATA)        != 0U) ? HAL_OSPI_DATA_DTR_ENABLE            : HAL_OSPI_DATA_DTR_DISABLE;
+  ptr_hal_cmd->DummyCycles           = cmd->dummy_cycles;
+  ptr_hal_cmd->DQSMode               = (cmd->dqs != 0U) ? HAL_OSPI_DQS_ENABLE : HAL_OSPI_DQS_DISABLE;
+  ptr_hal_cmd->SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+#endif
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t OSPI_ConvertStatus (HAL_StatusTypeDef hal_status)
+  \brief       Convert HAL status code to CMSIS-Driver status code.
+  \param[in]   hal_status      HAL status code
+  \return      \ref execution_status
+*/
+static int32_t OSPI_ConvertStatus (HAL_StatusTypeDef hal_status) {
+  int32_t ret;
+
+  switch (hal_status) {
+    case HAL_OK:
+      ret = ARM_DRIVER_OK;
+      break;
+
+    case HAL_BUSY:
+      ret = ARM_DRIVER_ERROR_BUSY;
+      break;
+
+    case HAL_TIMEOUT:
+      ret = ARM_DRIVER_ERROR_TIMEOUT;
+      break;
+
+    case HAL_ERROR:
+    default:
+      ret = ARM_DRIVER_ERROR;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          void OSPI_SignalEvent (const OSPI_Handle_t * const hospi, uint32_t event)
+  \brief       End the active command or transfer and signal event.
+  \param[in]   hospi    Pointer to OSPI (or QSPI) handle structure
+  \param[in]   event    Event to signal
+*/
+static void OSPI_SignalEvent (const OSPI_Handle_t * const hospi, uint32_t event) {
+  const RO_Info_t *ptr_ro_info;
+
+  ptr_ro_info = OSPI_GetInfo(hospi);
+
+  if (ptr_ro_info == NULL) {
+    return;
+  }
+  if (ptr_ro_info->ptr_rw_info == NULL) {
+    return;
+  }
+
+  ptr_ro_info->ptr_rw_info->xfer_active = 0U;
+
+  if (ptr_ro_info->ptr_rw_info->cb_event == NULL) {
+    return;
+  }
+
+  ptr_ro_info->ptr_rw_info->cb_event(event);
+}
+
+// Driver functions ************************************************************
+
+/**
+  \fn          ARM_DRIVER_VERSION OSPI_GetVersion (void)
+  \brief       Get driver version.
+  \return      \ref ARM_DRV_VERSION
+*/
+static ARM_DRIVER_VERSION OSPI_GetVersion (void) {
+  return driver_version;
+}
+
+/**
+  \fn          int32_t OSPIn_Initialize (const RO_Info_t * const ptr_ro_info, OSPI_STM32_SignalEvent_t cb_event)
+  \brief       Initialize OSPI Interface.
+  \param[in]   ptr_ro_info     Pointer to OSPI RO info structure (RO_Info_t)
+  \param[in]   cb_event        Pointer to event callback function
+  \return      \ref execution_status
+*/
+static int32_t OSPIn_Initialize (const RO_Info_t * const ptr_ro_info, OSPI_STM32_SignalEvent_t cb_event) {
+
+  // Clear run-time info
+  memset((void *)ptr_ro_info->ptr_rw_info, 0, sizeof(RW_Info_t));
+
+  // Register callback function
+  ptr_ro_info->ptr_rw_info->cb_event = cb_event;
+
+  // Set driver status to initialized
+  ptr_ro_info->ptr_rw_info->drv_status.initialized = 1U;
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t OSPIn_Uninitialize (const RO_Info_t * const ptr_ro_info)
+  \brief       De-initialize OSPI Interface.
+  \param[in]   ptr_ro_info     Pointer to OSPI RO info structure (RO_Info_t)
+  \return      \ref execution_status
+*/
+static int32_t OSPIn_Uninitialize (const RO_Info_t * const ptr_ro_info) {
+
+  if (ptr_ro_info->ptr_rw_info->drv_status.powered != 0U) {
+    // If peripheral is powered, power off the peripheral
+    (void)OSPIn_PowerControl(ptr_ro_info, ARM_POWER_OFF);
+  }
+
+  // Clear run-time info
+  memset((void *)ptr_ro_info->ptr_rw_info, 0, sizeof(RW_Info_t));
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t OSPIn_PowerControl (const RO_Info_t * const ptr_ro_info, ARM_POWER_STATE state)
+  \brief       Control OSPI Interface Power.
+  \param[in]   ptr_ro_info     Pointer to OSPI RO info structure (RO_Info_t)
+  \param[in]   state           Power state
+  \return      \ref execution_status
+*/
+static int32_t OSPIn_PowerControl (const RO_Info_t * const ptr_ro_info, ARM_POWER_STATE state) {
+
+  switch (state) {
+    case ARM_POWER_FULL:
+      if (ptr_ro_info->ptr_rw_info->drv_status.initialized == 0U) {
+        return ARM_DRIVER_ERROR;
+      }
+
+      ptr_ro_info->ptr_rw_info->mmap_timeout = 0U;
+      ptr_ro_info->ptr_rw_info->xfer_num     = 0U;
+      ptr_ro_info->ptr_rw_info->xfer_active  = 0U;
+      ptr_ro_info->ptr_rw_info->mem_mapped   = 0U;
+
+      // Initialize pins, clocks, interrupts and peripheral
+      if (OSPI_HAL_Init(ptr_ro_info->ptr_hospi) != HAL_OK) {
+        return ARM_DRIVER_ERROR;
+      }
+
+      // Set driver status to powered
+      ptr_ro_info->ptr_rw_info->drv_status.powered = 1U;
+      break;
+
+    case ARM_POWER_OFF:
+
+      // If transfer is in progress or memory-mapped mode is active, abort it
+      if ((ptr_ro_info->ptr_rw_info->xfer_active != 0U) || (ptr_ro_info->ptr_rw_info->mem_mapped != 0U)) {
+        (void)OSPIn_Control(ptr_ro_info, OSPI_STM32_ABORT_TRANSFER, 0U);
+      }
+
+      // De-initialize pins, clocks, interrupts and peripheral
+      (void)OSPI_HAL_DeInit(ptr_ro_info->ptr_hospi);
+
+      // Set driver status to not powered
+      ptr_ro_info->ptr_rw_info->drv_status.powered = 0U;
+      break;
+
+    case ARM_POWER_LOW:
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+
+    default:
+      return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t OSPIn_Command (const RO_Info_t * const ptr_ro_info, const OSPI_STM32_COMMAND *cmd)
+  \brief       Send command without data phase.
+  \param[in]   ptr_ro_info     Pointer to OSPI RO info structure (RO_Info_t)
+  \param[in]   cmd             Pointer to command description
+  \return      \ref execution_status
+*/
+static int32_t OSPIn_Command (const RO_Info_t * const ptr_ro_info, const OSPI_STM32_COMMAND *cmd) {
+  OSPI_Command_t hal_cmd;
+  int32_t        ret;
+
+  if (cmd == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  ret = OSPI_SetupCommand(cmd, 0U, 0U, &hal_cmd);
+  if (ret != ARM_DRIVER_OK) {
+    return ret;
+  }
+
+  if (ptr_ro_info->ptr_rw_info->drv_status.powered == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+  if ((ptr_ro_info->ptr_rw_info->xfer_active != 0U) || (ptr_ro_info->ptr_rw_info->mem_mapped != 0U)) {
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  ptr_ro_info->ptr_rw_info->xfer_num    = 0U;
+  ptr_ro_info->ptr_rw_info->xfer_active = 1U;
+
+  ret = OSPI_ConvertStatus(OSPI_HAL_Command_IT(ptr_ro_info->ptr_hospi, &hal_cmd));
+  if (ret != ARM_DRIVER_OK) {
+    ptr_ro_info->ptr_rw_info->xfer_active = 0U;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t OSPIn_Read (const RO_Info_t * const ptr_ro_info, const OSPI_STM32_COMMAND *cmd, void *data, uint32_t num)
+  \brief       Send command and read data in indirect mode.
+  \param[in]   ptr_ro_info     Pointer to OSPI RO info structure (RO_Info_t)
+  \param[in]   cmd             Pointer to command description
+  \param[out]  data            Pointer to buffer for data to read
+  \param[in]   num             Number of data bytes to read
+  \return      \ref execution_status
+*/
+static int32_t OSPIn_Read (const RO_Info_t * const ptr_ro_info, const OSPI_STM32_COMMAND *cmd, void *data, uint32_t num) {
+  OSPI_Command_t hal_cmd;
+  int32_t        ret;
+
+  if ((cmd == NULL) || (data == NULL) || (num == 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  ret = OSPI_SetupCommand(cmd, 1U, num, &hal_cmd);
+  if (ret != ARM_DRIVER_OK) {
+    return ret;
+  }
+
+  if (ptr_ro_info->ptr_rw_info->drv_status.powered == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+  if ((ptr_ro_info->ptr_rw_info->xfer_active != 0U) || (ptr_ro_info->ptr_rw_info->mem_mapped != 0U)) {
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  ptr_ro_info->ptr_rw_info->xfer_num    = num;
+  ptr_ro_info->ptr_rw_info->xfer_active = 1U;
+
+  // Configure command phases, data phase is started by receive function
+  ret = OSPI_ConvertStatus(OSPI_HAL_Command(ptr_ro_info->ptr_hospi, &hal_cmd, OSPI_COMMAND_TIMEOUT));
+  if (ret == ARM_DRIVER_OK) {
+    if (ptr_ro_info->ptr_hospi->hdma != NULL) {
+      ret = OSPI_ConvertStatus(OSPI_HAL_Receive_DMA(ptr_ro_info->ptr_hospi, (uint8_t *)data));
+    } else {
+      ret = OSPI_ConvertStatus(OSPI_HAL_Receive_IT (ptr_ro_info->ptr_hospi, (uint8_t *)data));
+    }
+  }
+  if (ret != ARM_DRIVER_OK) {
+    ptr_ro_info->ptr_rw_info->xfer_active = 0U;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t OSPIn_Write (const RO_Info_t * const ptr_ro_info, const OSPI_STM32_COMMAND *cmd, const void *data, uint32_t num)
+  \brief       Send command and write data in indirect mode.
+  \param[in]   ptr_ro_info     Pointer to OSPI RO info structure (RO_Info_t)
+  \param[in]   cmd             Pointer to command description
+  \param[in]   data            Pointer to buffer with data to write
+  \param[in]   num             Number of data bytes to write
+  \return      \ref execution_status
+*/
+static int32_t OSPIn_Write (const RO_Info_t * const ptr_ro_info, const OSPI_STM32_COMMAND *cmd, const void *data, uint32_t num) {
+  OSPI_Command_t hal_cmd;
+  int32_t        ret;
+
+  if ((cmd == NULL) || (data == NULL) || (num == 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  ret = OSPI_SetupCommand(cmd, 1U, num, &hal_cmd);
+  if (ret != ARM_DRIVER_OK) {
+    return ret;
+  }
+
+  if (ptr_ro_info->ptr_rw_info->drv_status.powered == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+  if ((ptr_ro_info->ptr_rw_info->xfer_active != 0U) || (ptr_ro_info->ptr_rw_info->mem_mapped != 0U)) {
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  ptr_ro_info->ptr_rw_info->xfer_num    = num;
+  ptr_ro_info->ptr_rw_info->xfer_active = 1U;
+
+  // Configure command phases, data phase is started by transmit function
+  ret = OSPI_ConvertStatus(OSPI_HAL_Command(ptr_ro_info->ptr_hospi, &hal_cmd, OSPI_COMMAND_TIMEOUT));
+  if (ret == ARM_DRIVER_OK) {
+    if (ptr_ro_info->ptr_hospi->hdma != NULL) {
+      ret = OSPI_ConvertStatus(OSPI_HAL_Transmit_DMA(ptr_ro_info->ptr_hospi, (uint8_t *)(uint32_t)data));
+    } else {
+      ret = OSPI_ConvertStatus(OSPI_HAL_Transmit_IT (ptr_ro_info->ptr_hospi, (uint8_t *)(uint32_t)data));
+    }
+  }
+  if (ret != ARM_DRIVER_OK) {
+    ptr_ro_info->ptr_rw_info->xfer_active = 0U;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t OSPIn_MemoryMapped (const RO_Info_t * const ptr_ro_info, const OSPI_STM32_COMMAND *read_cmd, const OSPI_STM32_COMMAND *write_cmd)
+  \brief       Enter or exit memory-mapped mode.
+  \param[in]   ptr_ro_info     Pointer to OSPI RO info structure (RO_Info_t)
+  \param[in]   read_cmd        Pointer to read command description (NULL - exit memory-mapped mode)
+  \param[in]   write_cmd       Pointer to write command description (NULL - memory-mapped region is read only)
+  \return      \ref execution_status
+*/
+static int32_t OSPIn_MemoryMapped (const RO_Info_t * const ptr_ro_info, const OSPI_STM32_COMMAND *read_cmd, const OSPI_STM32_COMMAND *write_cmd) {
+  OSPI_Command_t      hal_cmd;
+  OSPI_MemoryMapped_t hal_mmap;
+  int32_t             ret;
+
+  if (ptr_ro_info->ptr_rw_info->drv_status.powered == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (read_cmd == NULL) {
+    // Exit memory-mapped mode
+    if (ptr_ro_info->ptr_rw_info->mem_mapped != 0U) {
+      return OSPIn_Control(ptr_ro_info, OSPI_STM32_ABORT_TRANSFER, 0U);
+    }
+    return ARM_DRIVER_OK;
+  }
+
+  if ((ptr_ro_info->ptr_rw_info->xfer_active != 0U) || (ptr_ro_info->ptr_rw_info->mem_mapped != 0U)) {
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  memset(&hal_mmap, 0, sizeof(OSPI_MemoryMapped_t));
+  hal_mmap.TimeOutPeriod = ptr_ro_info->ptr_rw_info->mmap_timeout;
+
+#ifdef OSPI_VARIANT_QUADSPI
+  if (write_cmd != NULL) {
+    // Memory-mapped mode is read only
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+
+  ret = OSPI_SetupCommand(read_cmd, 1U, 0U, &hal_cmd);
+  if (ret != ARM_DRIVER_OK) {
+    return ret;
+  }
+
+  hal_mmap.TimeOutActivation = (hal_mmap.TimeOutPeriod != 0U) ? QSPI_TIMEOUT_COUNTER_ENABLE : QSPI_TIMEOUT_COUNTER_DISABLE;
+
+  ret = OSPI_ConvertStatus(HAL_QSPI_MemoryMapped(ptr_ro_info->ptr_hospi, &hal_cmd, &hal_mmap));
+#else
+  if (write_cmd != NULL) {
+    // Configure write command used for memory-mapped writes
+    ret = OSPI_SetupCommand(write_cmd, 1U, 0U, &hal_cmd);
+    if (ret != ARM_DRIVER_OK) {
+      return ret;
+    }
+    hal_cmd.OperationType = HAL_OSPI_OPTYPE_WRITE_CFG;
+    ret = OSPI_ConvertStatus(HAL_OSPI_Command(ptr_ro_info->ptr_hospi, &hal_cmd, OSPI_COMMAND_TIMEOUT));
+    if (ret != ARM_DRIVER_OK) {
+      return ret;
+    }
+  }
+
+  // Configure read command used for memory-mapped reads
+  ret = OSPI_SetupCommand(read_cmd, 1U, 0U, &hal_cmd);
+  if (ret != ARM_DRIVER_OK) {
+    return ret;
+  }
+  hal_cmd.OperationType = HAL_OSPI_OPTYPE_READ_CFG;
+  ret = OSPI_ConvertStatus(HAL_OSPI_Command(ptr_ro_info->ptr_hospi, &hal_cmd, OSPI_COMMAND_TIMEOUT));
+  if (ret != ARM_DRIVER_OK) {
+    return ret;
+  }
+
+  hal_mmap.TimeOutActivation = (hal_mmap.TimeOutPeriod != 0U) ? HAL_OSPI_TIMEOUT_COUNTER_ENABLE : HAL_OSPI_TIMEOUT_COUNTER_DISABLE;
+
+  ret = OSPI_ConvertStatus(HAL_OSPI_MemoryMapped(ptr_ro_info->ptr_hospi, &hal_mmap));
+#endif
+
+  if (ret == ARM_DRIVER_OK) {
+    ptr_ro_info->ptr_rw_info->mem_mapped = 1U;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          uint32_t OSPIn_GetDataCount (const RO_Info_t * const ptr_ro_info)
+  \brief       Get transferred data count.
+  \param[in]   ptr_ro_info     Pointer to OSPI RO info structure (RO_Info_t)
+  \return      number of data bytes transferred
+*/
+static uint32_t OSPIn_GetDataCount (const RO_Info_t * const ptr_ro_info) {
+
+  if (ptr_ro_info->ptr_rw_info->xfer_num == 0U) {
+    return 0U;
+  }
+
+  // In DMA mode HAL updates transfer counter when transfer completes
+  return (ptr_ro_info->ptr_hospi->XferSize - ptr_ro_info->ptr_hospi->XferCount);
+}
+
+/**
+  \fn          int32_t OSPIn_Control (const RO_Info_t * const ptr_ro_info, uint32_t control, uint32_t arg)
+  \brief       Control OSPI Interface.
+  \param[in]   ptr_ro_info     Pointer to OSPI RO info structure (RO_Info_t)
+  \param[in]   control         Operation
+  \param[in]   arg             Argument of operation (optional)
+  \return      \ref execution_status
+*/
+static int32_t OSPIn_Control (const RO_Info_t * const ptr_ro_info, uint32_t control, uint32_t arg) {
+
+  if (ptr_ro_info->ptr_rw_info->drv_status.powered == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  switch (control) {
+    case OSPI_STM32_ABORT_TRANSFER:             // Abort current command or data transfer
+      if (OSPI_HAL_Abort(ptr_ro_info->ptr_hospi) != HAL_OK) {
+        return ARM_DRIVER_ERROR;
+      }
+      ptr_ro_info->ptr_rw_info->xfer_active = 0U;
+      ptr_ro_info->ptr_rw_info->mem_mapped  = 0U;
+      break;
+
+    case OSPI_STM32_SET_MMAP_TIMEOUT:           // Set memory-mapped mode timeout
+      if (arg > OSPI_MMAP_TIMEOUT_MAX) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      ptr_ro_info->ptr_rw_info->mmap_timeout = arg;
+      break;
+
+    default:
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          OSPI_STM32_STATUS OSPIn_GetStatus (const RO_Info_t * const ptr_ro_info)
+  \brief       Get OSPI status.
+  \param[in]   ptr_ro_info     Pointer to OSPI RO info structure (RO_Info_t)
+  \return      OSPI status OSPI_STM32_STATUS
+*/
+static OSPI_STM32_STATUS OSPIn_GetStatus (const RO_Info_t * const ptr_ro_info) {
+  OSPI_STM32_STATUS status;
+
+  // Clear status structure
+  memset(&status, 0, sizeof(OSPI_STM32_STATUS));
+
+  if (ptr_ro_info->ptr_rw_info->xfer_active != 0U) {
+    status.busy = 1U;
+  }
+  if (ptr_ro_info->ptr_rw_info->mem_mapped != 0U) {
+    status.mem_mapped = 1U;
+  }
+  if (OSPI_HAL_GetError(ptr_ro_info->ptr_hospi) != OSPI_HAL_ERROR_NONE) {
+    status.error = 1U;
+  }
+
+  return status;
+}
+
+// HAL callback functions ******************************************************
+
+#ifdef OSPI_VARIANT_QUADSPI
+
+/**
+  \fn          void HAL_QSPI_CmdCpltCallback (QSPI_HandleTypeDef *hqspi)
+  \brief       Command completed callback.
+  \param[in]   hqspi    QSPI handle
+  */
+void HAL_QSPI_CmdCpltCallback (QSPI_HandleTypeDef *hqspi) {
+  OSPI_SignalEvent(hqspi, OSPI_STM32_EVENT_TRANSFER_COMPLETE);
+}
+
+/**
+  \fn          void HAL_QSPI_RxCpltCallback (QSPI_HandleTypeDef *hqspi)
+  \brief       Rx Transfer completed callback.
+  \param[in]   hqspi    QSPI handle
+  */
+void HAL_QSPI_RxCpltCallback (QSPI_HandleTypeDef *hqspi) {
+  OSPI_SignalEvent(hqspi, OSPI_STM32_EVENT_TRANSFER_COMPLETE);
+}
+
+/**
+  \fn          void HAL_QSPI_TxCpltCallback (QSPI_HandleTypeDef *hqspi)
+  \brief       Tx Transfer completed callback.
+  \param[in]   hqspi    QSPI handle
+  */
+void HAL_QSPI_TxCpltCallback (QSPI_HandleTypeDef *hqspi) {
+  OSPI_SignalEvent(hqspi, OSPI_STM32_EVENT_TRANSFER_COMPLETE);
+}
+
+/**
+  \fn          void HAL_QSPI_ErrorCallback (QSPI_HandleTypeDef *hqspi)
+  \brief       QSPI error callback.
+  \param[in]   hqspi    QSPI handle
+  */
+void HAL_QSPI_ErrorCallback (QSPI_HandleTypeDef *hqspi) {
+  OSPI_SignalEvent(hqspi, OSPI_STM32_EVENT_TRANSFER_ERROR);
+}
+
+#else
+
+/**
+  \fn          void HAL_OSPI_CmdCpltCallback (OSPI_HandleTypeDef *hospi)
+  \brief       Command completed callback.
+  \param[in]   hospi    OSPI handle
+  */
+void HAL_OSPI_CmdCpltCallback (OSPI_HandleTypeDef *hospi) {
+  OSPI_SignalEvent(hospi, OSPI_STM32_EVENT_TRANSFER_COMPLETE);
+}
+
+/**
+  \fn          void HAL_OSPI_RxCpltCallback (OSPI_HandleTypeDef *hospi)
+  \brief       Rx Transfer completed callback.
+  \param[in]   hospi    OSPI handle
+  */
+void HAL_OSPI_RxCpltCallback (OSPI_HandleTypeDef *hospi) {
+  OSPI_SignalEvent(hospi, OSPI_STM32_EVENT_TRANSFER_COMPLETE);
+}
+
+/**
+  \fn          void HAL_OSPI_TxCpltCallback (OSPI_HandleTypeDef *hospi)
+  \brief       Tx Transfer completed callback.
+  \param[in]   hospi    OSPI handle
+  */
+void HAL_OSPI_TxCpltCallback (OSPI_HandleTypeDef *hospi) {
+  OSPI_SignalEvent(hospi, OSPI_STM32_EVENT_TRANSFER_COMPLETE);
+}
+
+/**
+  \fn          void HAL_OSPI_ErrorCallback (OSPI_HandleTypeDef *hospi)
+  \brief       OSPI error callback.
+  \param[in]   hospi    OSPI handle
+  */
+void HAL_OSPI_ErrorCallback (OSPI_HandleTypeDef *hospi) {
+  OSPI_SignalEvent(hospi, OSPI_STM32_EVENT_TRANSFER_ERROR);
+}
+
+#endif
+
+// Local driver functions definitions (for instances)
+#if defined(MX_OCTOSPI1) || defined(MX_QUADSPI)
+FUNCS_DEFINE(1)
+#endif
+#ifdef MX_OCTOSPI2
+FUNCS_DEFINE(2)
+#endif
+
+// Global driver structures ****************************************************
+
+#if defined(MX_OCTOSPI1) || defined(MX_QUADSPI)
+OSPI_DRIVER(1)
+#endif
+#ifdef MX_OCTOSPI2
+OSPI_DRIVER(2)
+#endif
+
+#endif  // DRIVER_CONFIG_VALID
+
+/*! \endcond */
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * $Date:       18. October 2026
+ * $Revision:   V1.0
+ *
+ * Project:     OCTOSPI/QUADSPI Driver header for STMicroelectronics STM32 devices
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef OSPI_STM32_H_
+#define OSPI_STM32_H_
+
+#include "Driver_Common.h"
+#include "MX_Device.h"
+
+#ifdef  __cplusplus
+extern  "C"
+{
+#endif
+
+// OSPI API version
+#define OSPI_STM32_API_VERSION          ARM_DRIVER_VERSION_MAJOR_MINOR(1,0)
+
+// OSPI Control codes **********************************************************
+
+#define OSPI_STM32_ABORT_TRANSFER       (0x01UL)        // Abort current command or data transfer
+#define OSPI_STM32_SET_MMAP_TIMEOUT     (0x02UL)        // Set memory-mapped mode timeout; arg = number of clock cycles chip select stays active without access (0 = disabled)
+
+// OSPI Command DTR flags ******************************************************
+
+#define OSPI_STM32_DTR_INSTRUCTION      (1U << 0)       // Instruction phase in DTR (double transfer rate) mode
+#define OSPI_STM32_DTR_ADDRESS          (1U << 1)       // Address phase in DTR mode
+#define OSPI_STM32_DTR_ALT_BYTES        (1U << 2)       // Alternate bytes phase in DTR mode
+#define OSPI_STM32_DTR_DATA             (1U << 3)       // Data phase in DTR mode
+
+// OSPI Events *****************************************************************
+
+#define OSPI_STM32_EVENT_TRANSFER_COMPLETE (1UL << 0)   // Command or data transfer completed
+#define OSPI_STM32_EVENT_TRANSFER_ERROR    (1UL << 1)   // Command or data transfer ended with error
+
+// OSPI Command ****************************************************************
+
+typedef struct {
+  uint32_t instruction;                 // Instruction code
+  uint32_t address;                     // Address
+  uint32_t alt_bytes;                   // Alternate bytes
+  uint8_t  instruction_lines;           // Number of lines for instruction phase: 0 (no instruction), 1, 2, 4 or 8
+  uint8_t  instruction_size;            // Instruction size in bytes: 1 .. 4 (QUADSPI: 1)
+  uint8_t  address_lines;               // Number of lines for address phase: 0 (no address), 1, 2, 4 or 8
+  uint8_t  address_size;                // Address size in bytes: 1 .. 4
+  uint8_t  alt_bytes_lines;             // Number of lines for alternate bytes phase: 0 (no alternate bytes), 1, 2, 4 or 8
+  uint8_t  alt_bytes_size;              // Alternate bytes size in bytes: 1 .. 4
+  uint8_t  data_lines;                  // Number of lines for data phase: 1, 2, 4 or 8 (ignored for commands without data)
+  uint8_t  dummy_cycles;                // Number of dummy cycles between address/alternate bytes and data phase: 0 .. 31
+  uint8_t  dtr;                         // Phases in DTR mode: OSPI_STM32_DTR_xxx flags
+  uint8_t  dqs;                         // Data strobe (DQS): 0 - disabled, 1 - enabled (OCTOSPI only)
+} OSPI_STM32_COMMAND;
+
+// OSPI Status *****************************************************************
+
+typedef struct {
+  uint32_t busy       : 1;              // Command or data transfer in progress
+  uint32_t mem_mapped : 1;              // Memory-mapped mode active
+  uint32_t error      : 1;              // Error occurred during last command or data transfer
+  uint32_t reserved   : 29;
+} OSPI_STM32_STATUS;
+
+// OSPI Signal Event callback function type
+typedef void (*OSPI_STM32_SignalEvent_t) (uint32_t event);
+
+// OSPI Driver Access structure ************************************************
+
+typedef struct {
+  ARM_DRIVER_VERSION (*GetVersion)   (void);                                                         // Get driver version.
+  int32_t            (*Initialize)   (OSPI_STM32_SignalEvent_t cb_event);                            // Initialize OSPI Interface.
+  int32_t            (*Uninitialize) (void);                                                         // De-initialize OSPI Interface.
+  int32_t            (*PowerControl) (ARM_POWER_STATE state);                                        // Control OSPI Interface Power.
+  int32_t            (*Command)      (const OSPI_STM32_COMMAND *cmd);                                // Send command without data phase.
+  int32_t            (*Read)         (const OSPI_STM32_COMMAND *cmd,       void *data, uint32_t num); // Send command and read data (indirect mode).
+  int32_t            (*Write)        (const OSPI_STM32_COMMAND *cmd, const void *data, uint32_t num); // Send command and write data (indirect mode).
+  int32_t            (*MemoryMapped) (const OSPI_STM32_COMMAND *read_cmd, const OSPI_STM32_COMMAND *write_cmd); // Enter (read_cmd != NULL) or exit (read_cmd == NULL) memory-mapped mode.
+  uint32_t           (*GetDataCount) (void);                                                         // Get transferred data count.
+  int32_t            (*Control)      (uint32_t control, uint32_t arg);                               // Control OSPI Interface.
+  OSPI_STM32_STATUS  (*GetStatus)    (void);                                                         // Get OSPI status.
+} const OSPI_STM32_DRIVER;
+
+// Global driver structures ****************************************************
+
+#if     defined(MX_OCTOSPI1) || defined(MX_QUADSPI)
+extern  OSPI_STM32_DRIVER Driver_OSPI1;
+#endif
+#ifdef  MX_OCTOSPI2
+extern  OSPI_STM32_DRIVER Driver_OSPI2;
+#endif
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  // OSPI_STM32_H_
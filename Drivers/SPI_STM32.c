@@ -66,12 +66,6 @@ __Functional__ deviations:
   - PowerControl:
     - depends on the code generated by CubeMX.
     - low-power mode is not supported by HAL.
-  - Send:
-    - maximum number of data items supported by HAL with a single send request is 65535.
-  - Receive:
-    - maximum number of data items supported by HAL with a single receive request is 65535.
-  - Transfer:
-    - maximum number of data items supported by HAL with a single transfer request is 65535.
   - Control:
     - changes are not effective after this function but when data transfer operation is started
       (for example: changing Phase or Polarity will change clock line state when data operation is started
@@ -81,6 +75,129 @@ __Functional__ deviations:
   - SignalEvent:
     - mode fault and data lost detection does not work until data transfer operation is started.
 
+# Driver Specific Features
+
+Driver specific Control codes are defined in the **SPI_STM32.h** header file.
+
+## Polling Mode Transfer
+
+In **Master** mode, a **Transfer** of up to **polling mode threshold** data items is executed in polling mode:
+the function waits for the transfer to finish and signals the **ARM_SPI_EVENT_TRANSFER_COMPLETE** event before it returns.
+This avoids the DMA or interrupt setup overhead for short transfers (for example register access of a sensor).
+
+  - default threshold is **4** data items, it can be changed at compile-time by defining **SPI_POLLING_THRESHOLD**
+  - threshold can be changed at run-time with Control code **SPI_STM32_SET_POLLING_THRESHOLD** (arg = threshold, 0 = disabled),
+    max threshold is **256** data items
+  - transfer timeout is the transfer duration at the current bus speed plus **SPI_POLLING_TIMEOUT** (default **10** ms),
+    if the peripheral clock is unknown only **SPI_POLLING_TIMEOUT** is used
+
+## Transfers Larger than 65535 Data Items
+
+HAL supports at most 65535 data items with a single send, receive or transfer request.
+Larger **Send**, **Receive** and **Transfer** requests are split by the driver into segments of up to 65535 data items,
+next segment is started from the HAL transfer complete callback and the **ARM_SPI_EVENT_TRANSFER_COMPLETE** event
+is signaled only once, when the last segment has finished. **GetDataCount** returns the number of data items
+transferred since the start of the request.
+
+> **Note**
+>
+> - software controlled Slave Select (**ARM_SPI_SS_MASTER_SW**) stays active for the whole request, while with
+>   hardware controlled Slave Select output on some device series the Slave Select line is deactivated between segments.
+
+## FIFO Threshold and Data Packing
+
+On device series with SPI peripheral that has FIFO with configurable threshold (for example STM32H5, STM32H7 and STM32U5)
+the driver selects FIFO threshold and DMA data width for each DMA transfer:
+  - for 8-bit and 16-bit data items, if number of data items is a multiple of 4 (8-bit) or 2 (16-bit) and data buffers
+    are 4-byte aligned, DMA accesses are 32-bit wide and pack multiple data items (data packing)
+  - FIFO threshold is set to the number of data items packed in a single DMA access
+
+Behavior can be changed with the following Control codes:
+  - **SPI_STM32_SET_FIFO_THRESHOLD**: arg = FIFO threshold in data items (1 .. 16), or 0 for automatic selection (default)
+  - **SPI_STM32_SET_DATA_PACKING**: arg = 1 to enable (default), or 0 to disable DMA data packing
+
+> **Note**
+>
+> - FIFO threshold specified with **SPI_STM32_SET_FIFO_THRESHOLD** is also used for interrupt driven transfers and
+>   must not exceed the FIFO size of the used SPI peripheral (refer to the device reference manual).
+
+## Slave Streaming Mode
+
+For continuous reception of data in **Slave** mode (for example a sample stream from an ADC or FPGA) the driver
+offers streaming mode in which the **Receive** function starts a circular DMA reception that never ends:
+  - streaming mode is enabled with Control code **SPI_STM32_SET_STREAM_MODE** (arg = 1) after Slave mode was configured,
+    it is disabled with arg = 0 or by configuring the mode again
+  - **Receive** function starts the stream into the specified buffer which is from then on used as a ring buffer
+    owned by the driver
+  - event **SPI_STM32_EVENT_STREAM_HALF** is signaled when the first half of the buffer was filled and
+    event **SPI_STM32_EVENT_STREAM_FULL** is signaled when the second half of the buffer was filled,
+    the application must process each half before it is filled again
+  - **GetDataCount** returns the current write position (in data items) in the buffer, when called from the
+    Slave Select (NSS) edge interrupt it can be used as a frame marker
+  - stream is stopped with Control code **ARM_SPI_ABORT_TRANSFER**
+
+> **Notes**
+>
+> - streaming mode requires **DMA** for **SPI Rx** on a DMA controller that supports circular mode.
+> - in streaming mode the peripheral is configured as receive only, so **Send** and **Transfer** functions are not available
+>   and the MISO line is not driven.
+> - maximum buffer size in streaming mode is 65535 data items.
+> - DMA data packing and the FIFO threshold set with **SPI_STM32_SET_FIFO_THRESHOLD** are not used in streaming mode,
+>   DMA transfers single data items with FIFO threshold of one data item.
+
+## Hardware CRC
+
+The CRC unit of the SPI peripheral can be used to append the CRC to transmitted data and to verify the CRC of received data
+(for example CRC16 of SD card data blocks in SPI mode):
+  - Control code **SPI_STM32_SET_CRC_POLYNOMIAL** enables the CRC calculation with polynomial specified by arg
+    (arg = 0 disables the CRC calculation)
+  - Control code **SPI_STM32_SET_CRC_LENGTH** sets the CRC length in bits (arg = 0 selects CRC length equal to data size),
+    supported lengths depend on the device series
+  - when CRC calculation is enabled, every **Send**, **Receive** and **Transfer** request is followed by the CRC:
+    CRC is sent after the data and received CRC is checked against the calculated CRC
+  - CRC mismatch is signaled with events **SPI_STM32_EVENT_CRC_ERROR** and **ARM_SPI_EVENT_TRANSFER_COMPLETE**
+
+> **Notes**
+>
+> - when CRC calculation is enabled requests are limited to 65532 data items, DMA data packing is not used and
+>   streaming mode is not available.
+
+## Frame Timing
+
+For devices that require Slave Select deactivation between data frames (for example ADCs and DACs that start
+a conversion on the Slave Select edge) hardware controlled Slave Select output (**ARM_SPI_SS_MASTER_HW_OUTPUT**)
+can generate a pulse between consecutive data frames, so a single Send or Transfer request of multiple data items
+produces correctly framed conversions:
+  - Control code **SPI_STM32_SET_NSS_PULSE** enables (arg = 1) or disables (arg = 0, default) the NSS pulse
+  - Control code **SPI_STM32_SET_SS_IDLENESS** sets the number of clock cycles (0 .. 15) inserted between
+    Slave Select activation and the first data frame (MSSI)
+  - Control code **SPI_STM32_SET_INTERDATA_IDLENESS** sets the number of clock cycles (0 .. 15) inserted between
+    consecutive data frames (MIDI), with NSS pulse enabled Slave Select is inactive during this time
+
+> **Notes**
+>
+> - NSS pulse is only available on device series with SPI peripheral that supports it (for example STM32F7, STM32L4, STM32H7 and STM32U5),
+>   on some device series it is generated only with clock phase **ARM_SPI_CPOL0_CPHA0** or **ARM_SPI_CPOL1_CPHA0**
+>   (refer to the device reference manual).
+> - Master SS idleness and inter-data idleness are only available on device series with SPI peripheral that has FIFO with
+>   configurable threshold (for example STM32H5, STM32H7 and STM32U5).
+> - settings are kept when the mode is configured again.
+
+## Bus Speed Selection
+
+Bus speeds achievable with all baud rate prescaler settings are calculated from the SPI peripheral clock once,
+when the driver is powered up (**PowerControl** with **ARM_POWER_FULL**):
+  - **ARM_SPI_SET_BUS_SPEED** and mode configuration with **Control** select the fastest bus speed that does not exceed
+    the requested bus speed, the change is applied immediately if the SPI was already configured
+  - **ARM_SPI_GET_BUS_SPEED** returns the bus speed of the selected prescaler setting
+  - on device series that support prescaler bypass (for example STM32H5 and STM32U5) the peripheral clock itself
+    can be selected as bus speed in **Master** mode
+
+> **Note**
+>
+> - if the SPI peripheral clock is changed at runtime, the driver must be powered down and up again for
+>   the bus speeds to be recalculated.
+
 # CubeMX Configuration
 
 This driver requires the following configuration in CubeMX:
@@ -277,6 +394,30 @@ static const ARM_SPI_CAPABILITIES driver_capabilities = {
 #define SPI_VARIANT_NO_HAL_EX           1
 #endif
 
+// Determine if peripheral has FIFO with configurable threshold and supports data packing (STM32H5, STM32H7, STM32U5, ...)
+
+#ifdef  SPI_FIFO_THRESHOLD_01DATA
+#define SPI_VARIANT_FIFO_THRESHOLD      1
+#endif
+
+// Determine if DMA supports circular mode through DMA handle initialization structure
+
+#ifdef  DMA_CIRCULAR
+#define SPI_VARIANT_DMA_CIRCULAR        1
+#endif
+
+// Determine if peripheral supports NSS pulse between data frames (NSSP)
+
+#ifdef  SPI_NSS_PULSE_ENABLE
+#define SPI_VARIANT_NSS_PULSE           1
+#endif
+
+// Determine if peripheral supports Master SS and inter-data idleness (MSSI and MIDI) (STM32H5, STM32H7, STM32U5, ...)
+
+#ifdef  SPI_MASTER_SS_IDLENESS_00CYCLE
+#define SPI_VARIANT_IDLENESS            1
+#endif
+
 // *****************************************************************************
 
 #ifdef  DRIVER_CONFIG_VALID     // Driver code is available only if configuration is valid
@@ -356,6 +497,29 @@ ARM_DRIVER_SPI Driver_SPI##n = {        \
   SPI##n##_GetStatus                    \
 };
 
+// Polling mode transfer threshold definition
+#ifndef SPI_POLLING_THRESHOLD
+#define SPI_POLLING_THRESHOLD          (4U)             // Max number of data items transferred in polling mode (0 - disabled)
+#endif
+
+// Max polling mode transfer threshold (number of data items)
+#define SPI_POLLING_THRESHOLD_MAX      (256U)
+
+#if    (SPI_POLLING_THRESHOLD > SPI_POLLING_THRESHOLD_MAX)
+#error "SPI_POLLING_THRESHOLD exceeds max number of data items transferred in polling mode (256)!"
+#endif
+
+// Polling mode transfer timeout definition
+#ifndef SPI_POLLING_TIMEOUT
+#define SPI_POLLING_TIMEOUT            (10U)            // SPI polling mode transfer timeout, added to transfer duration (in ms)
+#endif
+
+// Number of selectable bus speeds (clock dividers 1, 2, 4, .. 256)
+#define SPI_BUS_SPEED_NUM              (9U)
+
+// Maximum number of data items in a single HAL transfer request (multiple of 4 to allow data packing)
+#define SPI_XFER_SEGMENT_MAX           (0xFFFCU)
+
 // Pin configuration
 typedef struct {
   GPIO_TypeDef                 *ptr_port;               // Pointer to pin's port
@@ -378,6 +542,22 @@ typedef struct {
   ARM_SPI_SignalEvent_t         cb_event;               // Event callback
   DriverStatus_t                drv_status;             // Driver status
   uint32_t                      default_tx_value;       // Default Tx value
+  uint32_t                      bus_speed[SPI_BUS_SPEED_NUM];   // Bus speeds (in Hz), index is log2 of clock divider (0 - peripheral clock unknown)
+  uint32_t                      polling_threshold;      // Max number of data items transferred in polling mode (0 - disabled)
+  uint32_t                      polling_cnt;            // Number of data items transferred in polling mode (0 - last transfer was not in polling mode)
+  const uint8_t                *xfer_data_out;          // Pointer to data to send for active segment
+        uint8_t                *xfer_data_in;           // Pointer to buffer for data to receive for active segment (NULL - send only)
+        uint32_t                xfer_num;               // Number of data items requested
+        uint32_t                xfer_cnt;               // Number of data items transferred by segments preceding the active segment
+        uint32_t                xfer_seg_num;           // Number of data items in active segment
+        uint8_t                 stream_mode;            // Slave streaming mode: 0 - disabled, 1 - enabled
+        uint8_t                 nss_pulse;              // NSS pulse between data frames: 0 - disabled, 1 - enabled
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+        uint8_t                 fifo_threshold;         // FIFO threshold in data items (0 - automatic)
+        uint8_t                 dma_packing;            // DMA data packing: 0 - disabled, 1 - enabled
+        uint8_t                 dma_pack;               // Number of data items packed in a single DMA access for active segment
+        uint8_t                 dma_width;              // Currently configured DMA data width (in bytes)
+#endif
 } RW_Info_t;
 
 // Instance compile-time information (RO)
@@ -447,6 +627,23 @@ INFO_WO_NSS_DEFINE(8)
 #endif
 #endif
 
+// Baud rate prescaler settings, index is log2 of clock divider
+static const uint32_t spi_prescaler[SPI_BUS_SPEED_NUM] = {
+#ifdef SPI_BAUDRATEPRESCALER_BYPASS
+  SPI_BAUDRATEPRESCALER_BYPASS,
+#else
+  0xFFFFFFFFU,                          // Clock divider 1 (prescaler bypass) not supported
+#endif
+  SPI_BAUDRATEPRESCALER_2,
+  SPI_BAUDRATEPRESCALER_4,
+  SPI_BAUDRATEPRESCALER_8,
+  SPI_BAUDRATEPRESCALER_16,
+  SPI_BAUDRATEPRESCALER_32,
+  SPI_BAUDRATEPRESCALER_64,
+  SPI_BAUDRATEPRESCALER_128,
+  SPI_BAUDRATEPRESCALER_256
+};
+
 // List of available SPI instance infos
 static const RO_Info_t * const spi_ro_info_list[] = {
 #ifdef MX_SPI1
@@ -479,6 +676,23 @@ static const RO_Info_t * const spi_ro_info_list[] = {
 // Local functions prototypes
 static const RO_Info_t         *SPI_GetInfo         (const SPI_HandleTypeDef * const hspi);
 static uint32_t                 SPIn_GetPeriphClock (const RO_Info_t * const ptr_ro_info);
+static void                     SPIn_InitBusSpeeds  (const RO_Info_t * const ptr_ro_info);
+static int32_t                  SPIn_SetBusSpeed    (const RO_Info_t * const ptr_ro_info, uint32_t bus_speed);
+static uint32_t                 SPIn_GetPollingTimeout(const RO_Info_t * const ptr_ro_info, uint32_t num);
+static int32_t                  SPIn_TransferPolling(const RO_Info_t * const ptr_ro_info, const void *data_out, void *data_in, uint32_t num);
+static uint32_t                 SPIn_GetItemSize    (const RO_Info_t * const ptr_ro_info);
+static void                     SPIn_SetDMAWidth    (DMA_HandleTypeDef *hdma, uint32_t width);
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+static int32_t                  SPIn_ConfigFIFO     (const RO_Info_t * const ptr_ro_info, uint32_t num, uint8_t use_dma);
+#endif
+static HAL_StatusTypeDef        SPIn_StartSegment   (const RO_Info_t * const ptr_ro_info);
+#ifdef SPI_VARIANT_DMA_CIRCULAR
+static int32_t                  SPIn_ReceiveStream  (const RO_Info_t * const ptr_ro_info, void *data, uint32_t num);
+static int32_t                  SPIn_SetStreamMode  (const RO_Info_t * const ptr_ro_info, uint32_t enable);
+#endif
+static int32_t                  SPIn_SetCRC         (const RO_Info_t * const ptr_ro_info, uint32_t control, uint32_t arg);
+static int32_t                  SPIn_SetFrameTiming (const RO_Info_t * const ptr_ro_info, uint32_t control, uint32_t arg);
+static uint32_t                 SPIn_NextSegment    (const RO_Info_t * const ptr_ro_info);
 static ARM_DRIVER_VERSION       SPI_GetVersion      (void);
 static ARM_SPI_CAPABILITIES     SPI_GetCapabilities (void);
 static int32_t                  SPIn_Initialize     (const RO_Info_t * const ptr_ro_info, ARM_SPI_SignalEvent_t cb_event);
@@ -555,6 +769,698 @@ static uint32_t SPIn_GetPeriphClock (const RO_Info_t * const ptr_ro_info) {
   return ptr_ro_info->peri_clock_freq;
 }
 
+/**
+  \fn          void SPIn_InitBusSpeeds (const RO_Info_t * const ptr_ro_info)
+  \brief       Calculate bus speeds achievable with all baud rate prescaler settings.
+  \param[in]   ptr_ro_info     Pointer to SPI RO info structure (RO_Info_t)
+*/
+static void SPIn_InitBusSpeeds (const RO_Info_t * const ptr_ro_info) {
+  uint32_t periph_clk;
+  uint32_t i;
+
+  periph_clk = SPIn_GetPeriphClock(ptr_ro_info);
+
+  for (i = 0U; i < SPI_BUS_SPEED_NUM; i++) {
+    ptr_ro_info->ptr_rw_info->bus_speed[i] = periph_clk >> i;
+  }
+}
+
+/**
+  \fn          int32_t SPIn_SetBusSpeed (const RO_Info_t * const ptr_ro_info, uint32_t bus_speed)
+  \brief       Select the fastest bus speed not above the requested bus speed.
+  \param[in]   ptr_ro_info     Pointer to SPI RO info structure (RO_Info_t)
+  \param[in]   bus_speed       Requested bus speed (in Hz)
+  \return      \ref execution_status
+*/
+static int32_t SPIn_SetBusSpeed (const RO_Info_t * const ptr_ro_info, uint32_t bus_speed) {
+  uint32_t periph_clk;
+  uint32_t div;
+  uint32_t idx;
+
+  periph_clk = ptr_ro_info->ptr_rw_info->bus_speed[0];
+  if (periph_clk == 0U) {
+    // If peripheral clock is unknown
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+  if (bus_speed == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  // Calculate minimum clock divider, rounded up
+  div = periph_clk / bus_speed;
+  if ((div * bus_speed) != periph_clk) {
+    div++;
+  }
+
+  // Round clock divider up to power of 2, table index is log2 of the divider
+  if (div <= 1U) {
+    idx = 0U;
+  } else {
+    idx = 32U - __CLZ(div - 1U);
+  }
+#ifndef SPI_BAUDRATEPRESCALER_BYPASS
+  if (idx == 0U) {
+    // Minimum clock divider is 2
+    idx = 1U;
+  }
+#endif
+
+  if (idx >= SPI_BUS_SPEED_NUM) {
+    // If requested bus speed is below the slowest achievable
+    return ARM_DRIVER_ERROR;
+  }
+
+  ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = spi_prescaler[idx];
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          uint32_t SPIn_GetPollingTimeout (const RO_Info_t * const ptr_ro_info, uint32_t num)
+  \brief       Get polling mode transfer timeout for number of data items at current bus speed.
+  \param[in]   ptr_ro_info     Pointer to SPI RO info structure (RO_Info_t)
+  \param[in]   num             Number of data items to transfer (up to SPI_POLLING_THRESHOLD_MAX)
+  \return      timeout (in ms)
+*/
+static uint32_t SPIn_GetPollingTimeout (const RO_Info_t * const ptr_ro_info, uint32_t num) {
+  uint32_t spi_clk, bits, i;
+
+  spi_clk = ptr_ro_info->ptr_rw_info->bus_speed[0];
+  if (spi_clk == 0U) {
+    // If peripheral clock is unknown, transfer duration cannot be determined
+    return SPI_POLLING_TIMEOUT;
+  }
+
+  for (i = 0U; i < SPI_BUS_SPEED_NUM; i++) {
+    if (spi_prescaler[i] == ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler) {
+      spi_clk = ptr_ro_info->ptr_rw_info->bus_speed[i];
+      break;
+    }
+  }
+
+  // Number of bits to transfer (data items rounded up to the size in memory)
+  bits = num * SPIn_GetItemSize(ptr_ro_info) * 8U;
+
+  // Transfer duration rounded up to ms (num is limited, so the product does not overflow)
+  return (SPI_POLLING_TIMEOUT + (((bits * 1000U) + spi_clk - 1U) / spi_clk));
+}
+
+/**
+  \fn          int32_t SPIn_TransferPolling (const RO_Info_t * const ptr_ro_info, const void *data_out, void *data_in, uint32_t num)
+  \brief       Send/receive data in polling mode and signal transfer complete event.
+  \param[in]   ptr_ro_info     Pointer to SPI RO info structure (RO_Info_t)
+  \param[in]   data_out        Pointer to buffer with data to send to SPI transmitter
+  \param[out]  data_in         Pointer to buffer for data to receive from SPI receiver
+  \param[in]   num             Number of data items to transfer
+  \return      \ref execution_status
+*/
+static int32_t SPIn_TransferPolling (const RO_Info_t * const ptr_ro_info, const void *data_out, void *data_in, uint32_t num) {
+  HAL_StatusTypeDef transfer_status;
+  int32_t           ret;
+  uint32_t          event;
+
+  ptr_ro_info->ptr_rw_info->polling_cnt = 0U;
+  ptr_ro_info->ptr_rw_info->xfer_num    = 0U;
+  ptr_ro_info->ptr_rw_info->xfer_cnt    = 0U;
+
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+  // FIFO threshold set for a previous DMA segment could exceed the number of items to transfer
+  if (SPIn_ConfigFIFO(ptr_ro_info, num, 0U) != ARM_DRIVER_OK) {
+    return ARM_DRIVER_ERROR;
+  }
+#endif
+
+  // Transfer the data, function returns when transfer has finished
+  transfer_status = HAL_SPI_TransmitReceive(ptr_ro_info->ptr_hspi, (uint8_t *)data_out, (uint8_t *)data_in, (uint16_t)num, SPIn_GetPollingTimeout(ptr_ro_info, num));
+
+  // Convert HAL status code to CMSIS-Driver status code
+  switch (transfer_status) {
+    case HAL_ERROR:
+      ret = ARM_DRIVER_ERROR;
+      break;
+
+    case HAL_BUSY:
+      ret = ARM_DRIVER_ERROR_BUSY;
+      break;
+
+    case HAL_OK:
+      ret = ARM_DRIVER_OK;
+      break;
+
+    case HAL_TIMEOUT:
+    default:
+      ret = ARM_DRIVER_ERROR;
+      break;
+  }
+
+  event = ARM_SPI_EVENT_TRANSFER_COMPLETE;
+  if ((ret == ARM_DRIVER_ERROR) && (HAL_SPI_GetError(ptr_ro_info->ptr_hspi) == HAL_SPI_ERROR_CRC)) {
+    // If data was transferred but CRC check failed
+    event |= SPI_STM32_EVENT_CRC_ERROR;
+    ret    = ARM_DRIVER_OK;
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    ptr_ro_info->ptr_rw_info->polling_cnt = num;
+
+    // Signal transfer complete event as for interrupt or DMA driven transfer
+    if (ptr_ro_info->ptr_rw_info->cb_event != NULL) {
+      ptr_ro_info->ptr_rw_info->cb_event(event);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  \fn          uint32_t SPIn_GetItemSize (const RO_Info_t * const ptr_ro_info)
+  \brief       Get size of a data item in memory for configured data size.
+  \param[in]   ptr_ro_info     Pointer to SPI RO info structure (RO_Info_t)
+  \return      data item size (in bytes)
+*/
+static uint32_t SPIn_GetItemSize (const RO_Info_t * const ptr_ro_info) {
+  uint32_t item_size;
+
+  if (ptr_ro_info->ptr_hspi->Init.DataSize <= SPI_DATASIZE_8BIT) {
+    item_size = 1U;
+  } else if (ptr_ro_info->ptr_hspi->Init.DataSize <= SPI_DATASIZE_16BIT) {
+    item_size = 2U;
+  } else {
+    item_size = 4U;
+  }
+
+  return item_size;
+}
+
+/**
+  \fn          void SPIn_SetDMAWidth (DMA_HandleTypeDef *hdma, uint32_t width)
+  \brief       Set memory and peripheral data width in DMA initialization structure.
+  \param[in]   hdma     Pointer to DMA handle
+  \param[in]   width    Data width (in bytes)
+*/
+static void SPIn_SetDMAWidth (DMA_HandleTypeDef *hdma, uint32_t width) {
+
+  if (width == 4U) {
+#if defined(DMA_MDATAALIGN_WORD)
+    hdma->Init.MemDataAlignment    = DMA_MDATAALIGN_WORD;
+    hdma->Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+#else
+    hdma->Init.SrcDataWidth        = DMA_SRC_DATAWIDTH_WORD;
+    hdma->Init.DestDataWidth       = DMA_DEST_DATAWIDTH_WORD;
+#endif
+  } else if (width == 2U) {
+#if defined(DMA_MDATAALIGN_HALFWORD)
+    hdma->Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;
+    hdma->Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+#else
+    hdma->Init.SrcDataWidth        = DMA_SRC_DATAWIDTH_HALFWORD;
+    hdma->Init.DestDataWidth       = DMA_DEST_DATAWIDTH_HALFWORD;
+#endif
+  } else {
+#if defined(DMA_MDATAALIGN_BYTE)
+    hdma->Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+    hdma->Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+#else
+    hdma->Init.SrcDataWidth        = DMA_SRC_DATAWIDTH_BYTE;
+    hdma->Init.DestDataWidth       = DMA_DEST_DATAWIDTH_BYTE;
+#endif
+  }
+}
+
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+/**
+  \fn          int32_t SPIn_ConfigFIFO (const RO_Info_t * const ptr_ro_info, uint32_t num, uint8_t use_dma)
+  \brief       Configure FIFO threshold and DMA data packing for the segment to be started.
+  \param[in]   ptr_ro_info     Pointer to SPI RO info structure (RO_Info_t)
+  \param[in]   num             Number of data items in segment
+  \param[in]   use_dma         DMA usage: 0 - segment is interrupt driven, 1 - segment uses DMA
+  \return      \ref execution_status
+*/
+static int32_t SPIn_ConfigFIFO (const RO_Info_t * const ptr_ro_info, uint32_t num, uint8_t use_dma) {
+  RW_Info_t *ptr_rw_info;
+  uint32_t   item_size;
+  uint32_t   pack;
+  uint32_t   threshold;
+  uint32_t   addr;
+
+  ptr_rw_info = ptr_ro_info->ptr_rw_info;
+  item_size   = SPIn_GetItemSize(ptr_ro_info);
+  pack        = 1U;
+
+  if ((use_dma != 0U) && (ptr_rw_info->dma_packing != 0U) && (item_size < 4U) &&
+      (ptr_ro_info->ptr_hspi->Init.CRCCalculation != SPI_CRCCALCULATION_ENABLE)) {
+    // Pack data items into 32-bit DMA accesses if number of items and buffer alignment allow it
+    pack = 4U / item_size;
+    addr = (uint32_t)ptr_rw_info->xfer_data_out | (uint32_t)ptr_rw_info->xfer_data_in;
+    if (((num % pack) != 0U) || ((addr & 3U) != 0U)) {
+      pack = 1U;
+    }
+  }
+  ptr_rw_info->dma_pack = (uint8_t)pack;
+
+  if ((use_dma != 0U) && (ptr_rw_info->dma_width != (item_size * pack))) {
+    // If DMA data width has to be changed, reconfigure DMA
+    ptr_rw_info->dma_width = (uint8_t)(item_size * pack);
+    if (ptr_ro_info->ptr_hspi->hdmarx != NULL) {
+      SPIn_SetDMAWidth(ptr_ro_info->ptr_hspi->hdmarx, ptr_rw_info->dma_width);
+      if (HAL_DMA_Init(ptr_ro_info->ptr_hspi->hdmarx) != HAL_OK) {
+        return ARM_DRIVER_ERROR;
+      }
+    }
+    if (ptr_ro_info->ptr_hspi->hdmatx != NULL) {
+      SPIn_SetDMAWidth(ptr_ro_info->ptr_hspi->hdmatx, ptr_rw_info->dma_width);
+      if (HAL_DMA_Init(ptr_ro_info->ptr_hspi->hdmatx) != HAL_OK) {
+        return ARM_DRIVER_ERROR;
+      }
+    }
+  }
+
+  // Determine FIFO threshold
+  if (ptr_rw_info->fifo_threshold != 0U) {
+    threshold = ((uint32_t)ptr_rw_info->fifo_threshold - 1U) << SPI_CFG1_FTHLV_Pos;
+  } else if (use_dma != 0U) {
+    threshold = (pack - 1U) << SPI_CFG1_FTHLV_Pos;
+  } else {
+    threshold = ptr_ro_info->ptr_hspi->Init.FifoThreshold;
+  }
+
+  if (threshold != (ptr_ro_info->ptr_hspi->Instance->CFG1 & SPI_CFG1_FTHLV)) {
+    // FIFO threshold can only be changed while SPI is disabled
+    __HAL_SPI_DISABLE(ptr_ro_info->ptr_hspi);
+    MODIFY_REG(ptr_ro_info->ptr_hspi->Instance->CFG1, SPI_CFG1_FTHLV, threshold);
+  }
+
+  return ARM_DRIVER_OK;
+}
+#endif
+
+/**
+  \fn          HAL_StatusTypeDef SPIn_StartSegment (const RO_Info_t * const ptr_ro_info)
+  \brief       Start send or transfer of the next segment of the active request.
+  \param[in]   ptr_ro_info     Pointer to SPI RO info structure (RO_Info_t)
+  \return      HAL status code
+*/
+static HAL_StatusTypeDef SPIn_StartSegment (const RO_Info_t * const ptr_ro_info) {
+  RW_Info_t        *ptr_rw_info;
+  HAL_StatusTypeDef status;
+  uint16_t          num;
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+  uint8_t           use_dma;
+#endif
+
+  ptr_rw_info = ptr_ro_info->ptr_rw_info;
+
+  if ((ptr_rw_info->xfer_num - ptr_rw_info->xfer_cnt) > SPI_XFER_SEGMENT_MAX) {
+    ptr_rw_info->xfer_seg_num = SPI_XFER_SEGMENT_MAX;
+  } else {
+    ptr_rw_info->xfer_seg_num = ptr_rw_info->xfer_num - ptr_rw_info->xfer_cnt;
+  }
+  num = (uint16_t)ptr_rw_info->xfer_seg_num;
+
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+  if (ptr_rw_info->xfer_data_in == NULL) {
+    use_dma = (ptr_ro_info->ptr_hspi->hdmatx != NULL) ? 1U : 0U;
+  } else {
+    use_dma = ((ptr_ro_info->ptr_hspi->hdmatx != NULL) && (ptr_ro_info->ptr_hspi->hdmarx != NULL)) ? 1U : 0U;
+  }
+  if (SPIn_ConfigFIFO(ptr_ro_info, num, use_dma) != ARM_DRIVER_OK) {
+    return HAL_ERROR;
+  }
+#endif
+
+  if (ptr_rw_info->xfer_data_in == NULL) {          // If send only
+    if (ptr_ro_info->ptr_hspi->hdmatx != NULL) {    // If DMA is used for Tx
+      status = HAL_SPI_Transmit_DMA(ptr_ro_info->ptr_hspi, (uint8_t *)ptr_rw_info->xfer_data_out, num);
+    } else {                                        // If DMA is not configured (IRQ mode)
+      status = HAL_SPI_Transmit_IT (ptr_ro_info->ptr_hspi, (uint8_t *)ptr_rw_info->xfer_data_out, num);
+    }
+  } else {
+    if ((ptr_ro_info->ptr_hspi->hdmatx != NULL) &&  // If DMA is used for Tx and
+        (ptr_ro_info->ptr_hspi->hdmarx != NULL)) {  // If DMA is used for Rx
+      status = HAL_SPI_TransmitReceive_DMA(ptr_ro_info->ptr_hspi, (uint8_t *)ptr_rw_info->xfer_data_out, ptr_rw_info->xfer_data_in, num);
+    } else {                                        // If DMA is not configured (IRQ mode)
+      status = HAL_SPI_TransmitReceive_IT (ptr_ro_info->ptr_hspi, (uint8_t *)ptr_rw_info->xfer_data_out, ptr_rw_info->xfer_data_in, num);
+    }
+  }
+
+  return status;
+}
+
+/**
+  \fn          uint32_t SPIn_NextSegment (const RO_Info_t * const ptr_ro_info)
+  \brief       Handle completion of active segment and start the next segment if request is not finished.
+  \param[in]   ptr_ro_info     Pointer to SPI RO info structure (RO_Info_t)
+  \return      event to signal (0 - next segment started, no event to signal)
+*/
+static uint32_t SPIn_NextSegment (const RO_Info_t * const ptr_ro_info) {
+  RW_Info_t *ptr_rw_info;
+  uint32_t   item_size;
+
+  ptr_rw_info = ptr_ro_info->ptr_rw_info;
+
+  if ((ptr_rw_info->xfer_cnt + ptr_rw_info->xfer_seg_num) >= ptr_rw_info->xfer_num) {
+    // If last segment has finished
+    return ARM_SPI_EVENT_TRANSFER_COMPLETE;
+  }
+
+  item_size = SPIn_GetItemSize(ptr_ro_info);
+
+  // Advance to the next segment
+  ptr_rw_info->xfer_data_out += ptr_rw_info->xfer_seg_num * item_size;
+  if (ptr_rw_info->xfer_data_in != NULL) {
+    ptr_rw_info->xfer_data_in += ptr_rw_info->xfer_seg_num * item_size;
+  }
+  ptr_rw_info->xfer_cnt += ptr_rw_info->xfer_seg_num;
+
+  if (SPIn_StartSegment(ptr_ro_info) != HAL_OK) {
+    // If next segment could not be started, end the request
+    ptr_rw_info->xfer_num     = ptr_rw_info->xfer_cnt;
+    ptr_rw_info->xfer_seg_num = 0U;
+    return ARM_SPI_EVENT_DATA_LOST;
+  }
+
+  return 0U;
+}
+
+#ifdef SPI_VARIANT_DMA_CIRCULAR
+/**
+  \fn          int32_t SPIn_ReceiveStream (const RO_Info_t * const ptr_ro_info, void *data, uint32_t num)
+  \brief       Start circular DMA reception in Slave streaming mode.
+  \param[in]   ptr_ro_info     Pointer to SPI RO info structure (RO_Info_t)
+  \param[out]  data            Pointer to ring buffer for data to receive from SPI receiver
+  \param[in]   num             Number of data items in ring buffer
+  \return      \ref execution_status
+*/
+static int32_t SPIn_ReceiveStream (const RO_Info_t * const ptr_ro_info, void *data, uint32_t num) {
+  HAL_StatusTypeDef receive_status;
+  int32_t           ret;
+
+  if (num > (uint32_t)UINT16_MAX) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  ptr_ro_info->ptr_rw_info->xfer_num = 0U;
+  ptr_ro_info->ptr_rw_info->xfer_cnt = 0U;
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+  ptr_ro_info->ptr_rw_info->dma_pack = 1U;
+#endif
+
+  // Start the reception, DMA in circular mode restarts it automatically when buffer is filled
+  receive_status = HAL_SPI_Receive_DMA(ptr_ro_info->ptr_hspi, (uint8_t *)data, (uint16_t)num);
+
+  // Convert HAL status code to CMSIS-Driver status code
+  switch (receive_status) {
+    case HAL_ERROR:
+      ret = ARM_DRIVER_ERROR;
+      break;
+
+    case HAL_BUSY:
+      ret = ARM_DRIVER_ERROR_BUSY;
+      break;
+
+    case HAL_OK:
+      ret = ARM_DRIVER_OK;
+      break;
+
+    case HAL_TIMEOUT:
+    default:
+      ret = ARM_DRIVER_ERROR;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t SPIn_SetStreamMode (const RO_Info_t * const ptr_ro_info, uint32_t enable)
+  \brief       Enable or disable Slave streaming mode.
+  \param[in]   ptr_ro_info     Pointer to SPI RO info structure (RO_Info_t)
+  \param[in]   enable          Streaming mode: 0 - disable, 1 - enable
+  \return      \ref execution_status
+*/
+static int32_t SPIn_SetStreamMode (const RO_Info_t * const ptr_ro_info, uint32_t enable) {
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+  uint32_t item_size;
+#endif
+
+  if (ptr_ro_info->ptr_hspi->hdmarx == NULL) {
+    // If DMA is not used for Rx
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+
+  if (enable != 0U) {
+    if ((ptr_ro_info->ptr_rw_info->drv_status.configured == 0U) ||
+        (ptr_ro_info->ptr_hspi->Init.Mode != SPI_MODE_SLAVE)) {
+      // If Slave mode is not configured
+      return ARM_DRIVER_ERROR;
+    }
+    if (ptr_ro_info->ptr_hspi->Init.CRCCalculation == SPI_CRCCALCULATION_ENABLE) {
+      // CRC is not supported in streaming mode
+      return ARM_DRIVER_ERROR;
+    }
+    ptr_ro_info->ptr_hspi->hdmarx->Init.Mode = DMA_CIRCULAR;
+    ptr_ro_info->ptr_hspi->Init.Direction    = SPI_DIRECTION_2LINES_RXONLY;
+  } else {
+    ptr_ro_info->ptr_hspi->hdmarx->Init.Mode = DMA_NORMAL;
+    ptr_ro_info->ptr_hspi->Init.Direction    = SPI_DIRECTION_2LINES;
+  }
+
+  ptr_ro_info->ptr_rw_info->stream_mode = 0U;
+
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+  item_size = SPIn_GetItemSize(ptr_ro_info);
+  if ((enable != 0U) && (ptr_ro_info->ptr_rw_info->dma_width != item_size)) {
+    // Data packing is not used in streaming mode, DMA transfers single data items
+    ptr_ro_info->ptr_rw_info->dma_width = (uint8_t)item_size;
+    SPIn_SetDMAWidth(ptr_ro_info->ptr_hspi->hdmarx, item_size);
+    if (ptr_ro_info->ptr_hspi->hdmatx != NULL) {
+      SPIn_SetDMAWidth(ptr_ro_info->ptr_hspi->hdmatx, item_size);
+      if (HAL_DMA_Init(ptr_ro_info->ptr_hspi->hdmatx) != HAL_OK) {
+        return ARM_DRIVER_ERROR;
+      }
+    }
+  }
+#endif
+
+  // Reconfigure DMA for Rx
+  if (HAL_DMA_Init(ptr_ro_info->ptr_hspi->hdmarx) != HAL_OK) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  // Reconfigure SPI
+  if (HAL_SPI_Init(ptr_ro_info->ptr_hspi) != HAL_OK) {
+    return ARM_DRIVER_ERROR;
+  }
+
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+  if (enable != 0U) {
+    // FIFO threshold of one data item for DMA transferring single data items (SPI is disabled after HAL_SPI_Init)
+    MODIFY_REG(ptr_ro_info->ptr_hspi->Instance->CFG1, SPI_CFG1_FTHLV, SPI_FIFO_THRESHOLD_01DATA);
+  }
+#endif
+
+  if (enable != 0U) {
+    ptr_ro_info->ptr_rw_info->stream_mode = 1U;
+  }
+
+  return ARM_DRIVER_OK;
+}
+#endif
+
+/**
+  \fn          int32_t SPIn_SetCRC (const RO_Info_t * const ptr_ro_info, uint32_t control, uint32_t arg)
+  \brief       Configure hardware CRC calculation.
+  \param[in]   ptr_ro_info     Pointer to SPI RO info structure (RO_Info_t)
+  \param[in]   control         SPI_STM32_SET_CRC_POLYNOMIAL or SPI_STM32_SET_CRC_LENGTH
+  \param[in]   arg             CRC polynomial (0 = disabled) or CRC length in bits (0 = same as data size)
+  \return      \ref execution_status
+*/
+static int32_t SPIn_SetCRC (const RO_Info_t * const ptr_ro_info, uint32_t control, uint32_t arg) {
+
+  if (ptr_ro_info->ptr_rw_info->stream_mode != 0U) {
+    // CRC is not supported in streaming mode
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (control == SPI_STM32_SET_CRC_POLYNOMIAL) {
+    if (arg == 0U) {
+      ptr_ro_info->ptr_hspi->Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
+    } else {
+      ptr_ro_info->ptr_hspi->Init.CRCCalculation = SPI_CRCCALCULATION_ENABLE;
+      ptr_ro_info->ptr_hspi->Init.CRCPolynomial  = arg;
+    }
+  } else {
+#ifdef SPI_CRC_LENGTH_DATASIZE
+    switch (arg) {
+      case 0U:  ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_DATASIZE; break;
+#ifdef SPI_CRC_LENGTH_4BIT
+      case 4U:  ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_4BIT;  break;
+#endif
+#ifdef SPI_CRC_LENGTH_5BIT
+      case 5U:  ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_5BIT;  break;
+#endif
+#ifdef SPI_CRC_LENGTH_6BIT
+      case 6U:  ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_6BIT;  break;
+#endif
+#ifdef SPI_CRC_LENGTH_7BIT
+      case 7U:  ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_7BIT;  break;
+#endif
+#ifdef SPI_CRC_LENGTH_8BIT
+      case 8U:  ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_8BIT;  break;
+#endif
+#ifdef SPI_CRC_LENGTH_9BIT
+      case 9U:  ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_9BIT;  break;
+#endif
+#ifdef SPI_CRC_LENGTH_10BIT
+      case 10U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_10BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_11BIT
+      case 11U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_11BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_12BIT
+      case 12U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_12BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_13BIT
+      case 13U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_13BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_14BIT
+      case 14U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_14BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_15BIT
+      case 15U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_15BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_16BIT
+      case 16U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_16BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_17BIT
+      case 17U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_17BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_18BIT
+      case 18U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_18BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_19BIT
+      case 19U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_19BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_20BIT
+      case 20U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_20BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_21BIT
+      case 21U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_21BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_22BIT
+      case 22U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_22BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_23BIT
+      case 23U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_23BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_24BIT
+      case 24U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_24BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_25BIT
+      case 25U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_25BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_26BIT
+      case 26U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_26BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_27BIT
+      case 27U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_27BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_28BIT
+      case 28U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_28BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_29BIT
+      case 29U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_29BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_30BIT
+      case 30U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_30BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_31BIT
+      case 31U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_31BIT; break;
+#endif
+#ifdef SPI_CRC_LENGTH_32BIT
+      case 32U: ptr_ro_info->ptr_hspi->Init.CRCLength = SPI_CRC_LENGTH_32BIT; break;
+#endif
+      default:
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+#else
+    if (arg != 0U) {
+      // CRC length is always equal to data size
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+#endif
+  }
+
+  if (ptr_ro_info->ptr_rw_info->drv_status.configured != 0U) {
+    // Reconfigure SPI
+    if (HAL_SPI_Init(ptr_ro_info->ptr_hspi) != HAL_OK) {
+      return ARM_DRIVER_ERROR;
+    }
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t SPIn_SetFrameTiming (const RO_Info_t * const ptr_ro_info, uint32_t control, uint32_t arg)
+  \brief       Configure NSS pulse and idleness between data frames (Master mode).
+  \param[in]   ptr_ro_info     Pointer to SPI RO info structure (RO_Info_t)
+  \param[in]   control         SPI_STM32_SET_NSS_PULSE, SPI_STM32_SET_SS_IDLENESS or SPI_STM32_SET_INTERDATA_IDLENESS
+  \param[in]   arg             NSS pulse enable (0 or 1) or idleness in clock cycles (0 .. 15)
+  \return      \ref execution_status
+*/
+static int32_t SPIn_SetFrameTiming (const RO_Info_t * const ptr_ro_info, uint32_t control, uint32_t arg) {
+
+  switch (control) {
+    case SPI_STM32_SET_NSS_PULSE:
+#ifdef SPI_VARIANT_NSS_PULSE
+      ptr_ro_info->ptr_rw_info->nss_pulse = (arg != 0U) ? 1U : 0U;
+      if (ptr_ro_info->ptr_hspi->Init.NSS != SPI_NSS_HARD_OUTPUT) {
+        // Applied when hardware controlled Slave Select output is configured
+        return ARM_DRIVER_OK;
+      }
+      ptr_ro_info->ptr_hspi->Init.NSSPMode = (arg != 0U) ? SPI_NSS_PULSE_ENABLE : SPI_NSS_PULSE_DISABLE;
+      break;
+#else
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+
+    case SPI_STM32_SET_SS_IDLENESS:
+#ifdef SPI_VARIANT_IDLENESS
+      if (arg > 15U) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      ptr_ro_info->ptr_hspi->Init.MasterSSIdleness = arg << SPI_CFG2_MSSI_Pos;
+      break;
+#else
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+
+    case SPI_STM32_SET_INTERDATA_IDLENESS:
+#ifdef SPI_VARIANT_IDLENESS
+      if (arg > 15U) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      ptr_ro_info->ptr_hspi->Init.MasterInterDataIdleness = arg << SPI_CFG2_MIDI_Pos;
+      break;
+#else
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+
+    default:
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+
+  if (ptr_ro_info->ptr_rw_info->drv_status.configured != 0U) {
+    // Reconfigure SPI
+    if (HAL_SPI_Init(ptr_ro_info->ptr_hspi) != HAL_OK) {
+      return ARM_DRIVER_ERROR;
+    }
+  }
+
+  return ARM_DRIVER_OK;
+}
+
 // Driver functions ************************************************************
 
 /**
@@ -633,6 +1539,19 @@ static int32_t SPIn_PowerControl (const RO_Info_t * const ptr_ro_info, ARM_POWER
       // Clear default Tx value
       ptr_ro_info->ptr_rw_info->default_tx_value = 0U;
 
+      // Calculate achievable bus speeds
+      SPIn_InitBusSpeeds(ptr_ro_info);
+
+      // Set default polling mode threshold
+      ptr_ro_info->ptr_rw_info->polling_threshold = SPI_POLLING_THRESHOLD;
+
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+      // Set automatic FIFO threshold selection and enable DMA data packing
+      ptr_ro_info->ptr_rw_info->fifo_threshold = 0U;
+      ptr_ro_info->ptr_rw_info->dma_packing    = 1U;
+      ptr_ro_info->ptr_rw_info->dma_width      = 0U;
+#endif
+
       // Initialize pins, clocks, interrupts and peripheral
       if (HAL_SPI_Init(ptr_ro_info->ptr_hspi) != HAL_OK) {
         return ARM_DRIVER_ERROR;
@@ -678,22 +1597,30 @@ static int32_t SPIn_Send (const RO_Info_t * const ptr_ro_info, const void *data,
   HAL_StatusTypeDef send_status;
   int32_t           ret;
 
-  if ((data == NULL) || (num == 0U) || (num > (uint32_t)UINT16_MAX)) {
+  if ((data == NULL) || (num == 0U)) {
     // If any parameter is invalid
     return ARM_DRIVER_ERROR_PARAMETER;
   }
 
-  if (ptr_ro_info->ptr_rw_info->drv_status.configured == 0U) {
-    return ARM_DRIVER_ERROR;
+  if ((num > SPI_XFER_SEGMENT_MAX) && (ptr_ro_info->ptr_hspi->Init.CRCCalculation == SPI_CRCCALCULATION_ENABLE)) {
+    // With CRC calculation request cannot be split into segments
+    return ARM_DRIVER_ERROR_PARAMETER;
   }
 
-  // Start the send
-  if (ptr_ro_info->ptr_hspi->hdmatx != NULL) {  // If DMA is used for Tx
-    send_status = HAL_SPI_Transmit_DMA(ptr_ro_info->ptr_hspi, (uint8_t *)data, (uint16_t)num);
-  } else {                                      // If DMA is not configured (IRQ mode)
-    send_status = HAL_SPI_Transmit_IT (ptr_ro_info->ptr_hspi, (uint8_t *)data, (uint16_t)num);
+  if ((ptr_ro_info->ptr_rw_info->drv_status.configured == 0U) ||
+      (ptr_ro_info->ptr_rw_info->stream_mode          != 0U)) {
+    return ARM_DRIVER_ERROR;
   }
 
+  ptr_ro_info->ptr_rw_info->polling_cnt   = 0U;
+  ptr_ro_info->ptr_rw_info->xfer_data_out = (const uint8_t *)data;
+  ptr_ro_info->ptr_rw_info->xfer_data_in  = NULL;
+  ptr_ro_info->ptr_rw_info->xfer_num      = num;
+  ptr_ro_info->ptr_rw_info->xfer_cnt      = 0U;
+
+  // Start the send (of the first segment)
+  send_status = SPIn_StartSegment(ptr_ro_info);
+
   // Convert HAL status code to CMSIS-Driver status code
   switch (send_status) {
     case HAL_ERROR:
@@ -733,15 +1660,29 @@ static int32_t SPIn_Receive (const RO_Info_t * const ptr_ro_info, void *data, ui
   uint16_t         *ptr_u16;
   uint32_t         *ptr_u32;
 
-  if ((data == NULL) || (num == 0U) || (num > (uint32_t)UINT16_MAX)) {
+  if ((data == NULL) || (num == 0U)) {
     // If any parameter is invalid
     return ARM_DRIVER_ERROR_PARAMETER;
   }
 
+  if ((num > SPI_XFER_SEGMENT_MAX) && (ptr_ro_info->ptr_hspi->Init.CRCCalculation == SPI_CRCCALCULATION_ENABLE)) {
+    // With CRC calculation request cannot be split into segments
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
   if (ptr_ro_info->ptr_rw_info->drv_status.configured == 0U) {
     return ARM_DRIVER_ERROR;
   }
 
+  ptr_ro_info->ptr_rw_info->polling_cnt = 0U;
+
+#ifdef SPI_VARIANT_DMA_CIRCULAR
+  if (ptr_ro_info->ptr_rw_info->stream_mode != 0U) {
+    // In streaming mode start circular DMA reception
+    return SPIn_ReceiveStream(ptr_ro_info, data, num);
+  }
+#endif
+
   // Since HAL does not support default value for Transmission during Reception,
   // this is emulated by loading receive buffer with default values and providing it
   // to TransmitReceive function as transmit buffer also
@@ -767,13 +1708,13 @@ static int32_t SPIn_Receive (const RO_Info_t * const ptr_ro_info, void *data, ui
     }
   }
 
-  // Start the reception
-  if ((ptr_ro_info->ptr_hspi->hdmatx != NULL) &&    // If DMA is used for Tx and
-      (ptr_ro_info->ptr_hspi->hdmarx != NULL)) {    // If DMA is used for Rx
-    receive_status = HAL_SPI_TransmitReceive_DMA(ptr_ro_info->ptr_hspi, (uint8_t *)data, (uint8_t *)data, (uint16_t)num);
-  } else {                                          // If DMA is not configured (IRQ mode)
-    receive_status = HAL_SPI_TransmitReceive_IT (ptr_ro_info->ptr_hspi, (uint8_t *)data, (uint8_t *)data, (uint16_t)num);
-  }
+  ptr_ro_info->ptr_rw_info->xfer_data_out = (const uint8_t *)data;
+  ptr_ro_info->ptr_rw_info->xfer_data_in  = (uint8_t *)data;
+  ptr_ro_info->ptr_rw_info->xfer_num      = num;
+  ptr_ro_info->ptr_rw_info->xfer_cnt      = 0U;
+
+  // Start the reception (of the first segment)
+  receive_status = SPIn_StartSegment(ptr_ro_info);
 
   // Convert HAL status code to CMSIS-Driver status code
   switch (receive_status) {
@@ -811,23 +1752,36 @@ static int32_t SPIn_Transfer (const RO_Info_t * const ptr_ro_info, const void *d
   HAL_StatusTypeDef transfer_status;
   int32_t           ret;
 
-  if ((data_out == NULL) || (data_in == NULL) || (num == 0U) || (num > (uint32_t)UINT16_MAX)) {
+  if ((data_out == NULL) || (data_in == NULL) || (num == 0U)) {
     // If any parameter is invalid
     return ARM_DRIVER_ERROR_PARAMETER;
   }
 
-  if (ptr_ro_info->ptr_rw_info->drv_status.configured == 0U) {
+  if ((num > SPI_XFER_SEGMENT_MAX) && (ptr_ro_info->ptr_hspi->Init.CRCCalculation == SPI_CRCCALCULATION_ENABLE)) {
+    // With CRC calculation request cannot be split into segments
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((ptr_ro_info->ptr_rw_info->drv_status.configured == 0U) ||
+      (ptr_ro_info->ptr_rw_info->stream_mode          != 0U)) {
     return ARM_DRIVER_ERROR;
   }
 
-  // Start the transfer
-  if ((ptr_ro_info->ptr_hspi->hdmatx != NULL) &&    // If DMA is used for Tx and
-      (ptr_ro_info->ptr_hspi->hdmarx != NULL)) {    // If DMA is used for Rx
-    transfer_status = HAL_SPI_TransmitReceive_DMA(ptr_ro_info->ptr_hspi, (uint8_t *)data_out, (uint8_t *)data_in, (uint16_t)num);
-  } else {                                          // If DMA is not configured (IRQ mode)
-    transfer_status = HAL_SPI_TransmitReceive_IT (ptr_ro_info->ptr_hspi, (uint8_t *)data_out, (uint8_t *)data_in, (uint16_t)num);
+  if ((ptr_ro_info->ptr_hspi->Init.Mode == SPI_MODE_MASTER) &&
+      (num <= ptr_ro_info->ptr_rw_info->polling_threshold)) {
+    // If Master transfer is short, transfer it in polling mode
+    return SPIn_TransferPolling(ptr_ro_info, data_out, data_in, num);
   }
 
+  ptr_ro_info->ptr_rw_info->polling_cnt   = 0U;
+  ptr_ro_info->ptr_rw_info->xfer_data_out = (const uint8_t *)data_out;
+  ptr_ro_info->ptr_rw_info->xfer_data_in  = (uint8_t *)data_in;
+  ptr_ro_info->ptr_rw_info->xfer_num      = num;
+  ptr_ro_info->ptr_rw_info->xfer_cnt      = 0U;
+
+  // Start the transfer (of the first segment)
+  transfer_status = SPIn_StartSegment(ptr_ro_info);
+
   // Convert HAL status code to CMSIS-Driver status code
   switch (transfer_status) {
     case HAL_ERROR:
@@ -865,12 +1819,20 @@ static uint32_t SPIn_GetDataCount (const RO_Info_t * const ptr_ro_info) {
     return 0U;
   }
 
+  if (ptr_ro_info->ptr_rw_info->polling_cnt != 0U) {
+    // If last transfer was done in polling mode
+    return ptr_ro_info->ptr_rw_info->polling_cnt;
+  }
+
   cnt = 0U;
 
   if ((ptr_ro_info->ptr_hspi->pRxBuffPtr != NULL) && (ptr_ro_info->ptr_hspi->RxXferSize != 0U)) {
     // If reception was activated
     if (ptr_ro_info->ptr_hspi->hdmarx != NULL) {        // If DMA is used for Rx
       cnt_xferred = __HAL_DMA_GET_COUNTER(ptr_ro_info->ptr_hspi->hdmarx);
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+      cnt_xferred *= ptr_ro_info->ptr_rw_info->dma_pack;
+#endif
     } else {
       cnt_xferred = ptr_ro_info->ptr_hspi->RxXferCount;
     }
@@ -880,6 +1842,9 @@ static uint32_t SPIn_GetDataCount (const RO_Info_t * const ptr_ro_info) {
     // If transmission was activated
     if (ptr_ro_info->ptr_hspi->hdmatx != NULL) {        // If DMA is used for Tx
       cnt_xferred = __HAL_DMA_GET_COUNTER(ptr_ro_info->ptr_hspi->hdmatx);
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+      cnt_xferred *= ptr_ro_info->ptr_rw_info->dma_pack;
+#endif
     } else {
       cnt_xferred = ptr_ro_info->ptr_hspi->TxXferCount;
     }
@@ -887,6 +1852,9 @@ static uint32_t SPIn_GetDataCount (const RO_Info_t * const ptr_ro_info) {
     cnt = (uint32_t)ptr_ro_info->ptr_hspi->TxXferSize - cnt_xferred;
   }
 
+  // Add number of data items transferred by preceding segments
+  cnt += ptr_ro_info->ptr_rw_info->xfer_cnt;
+
   return cnt;
 }
 
@@ -900,8 +1868,10 @@ static uint32_t SPIn_GetDataCount (const RO_Info_t * const ptr_ro_info) {
 */
 static int32_t SPIn_Control (const RO_Info_t * const ptr_ro_info, uint32_t control, uint32_t arg) {
   GPIO_InitTypeDef GPIO_InitStruct;
-  uint32_t         periph_clk;
   uint32_t         spi_clk;
+  uint32_t         i;
+  int32_t          ret;
+  uint32_t         dma_width;
   uint8_t          reconfigure_nss_pin;
 
   if (ptr_ro_info->ptr_rw_info->drv_status.powered == 0U) {
@@ -910,6 +1880,8 @@ static int32_t SPIn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
 
   // Special handling for Abort Transfer command
   if ((control & ARM_SPI_CONTROL_Msk) == ARM_SPI_ABORT_TRANSFER) {
+    // Prevent start of further segments
+    ptr_ro_info->ptr_rw_info->xfer_num = ptr_ro_info->ptr_rw_info->xfer_cnt;
     if (HAL_SPI_Abort(ptr_ro_info->ptr_hspi) != HAL_OK) {
       return ARM_DRIVER_ERROR;
     }
@@ -948,37 +1920,26 @@ static int32_t SPIn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
 
                                                 // --- Control Miscellaneous
     case ARM_SPI_SET_BUS_SPEED:                 // Set Bus Speed in bps; arg = value
-      periph_clk = SPIn_GetPeriphClock(ptr_ro_info);
-      if (periph_clk == 0U) {
-        // If peripheral clock is unknown
-        return ARM_DRIVER_ERROR_UNSUPPORTED;
+      ret = SPIn_SetBusSpeed(ptr_ro_info, arg);
+      if ((ret == ARM_DRIVER_OK) && (ptr_ro_info->ptr_rw_info->drv_status.configured != 0U)) {
+        // Apply new bus speed
+        if (HAL_SPI_Init(ptr_ro_info->ptr_hspi) != HAL_OK) {
+          return ARM_DRIVER_ERROR;
+        }
       }
-      if      ((periph_clk >> 1) <= arg) { ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_2;   }
-      else if ((periph_clk >> 2) <= arg) { ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_4;   }
-      else if ((periph_clk >> 3) <= arg) { ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_8;   }
-      else if ((periph_clk >> 4) <= arg) { ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_16;  }
-      else if ((periph_clk >> 5) <= arg) { ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_32;  }
-      else if ((periph_clk >> 6) <= arg) { ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_64;  }
-      else if ((periph_clk >> 7) <= arg) { ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_256; }
-      else                               { return ARM_DRIVER_ERROR;                                                   }
-      return ARM_DRIVER_OK;
+      return ret;
 
     case ARM_SPI_GET_BUS_SPEED:                 // Get Bus Speed in bps
-      periph_clk = SPIn_GetPeriphClock(ptr_ro_info);
-      if (periph_clk == 0U) {
+      if (ptr_ro_info->ptr_rw_info->bus_speed[0] == 0U) {
         // If peripheral clock is unknown
         return ARM_DRIVER_ERROR_UNSUPPORTED;
       }
-      switch (ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler) {
-        case SPI_BAUDRATEPRESCALER_2:   spi_clk = periph_clk >> 1; break;
-        case SPI_BAUDRATEPRESCALER_4:   spi_clk = periph_clk >> 2; break;
-        case SPI_BAUDRATEPRESCALER_8:   spi_clk = periph_clk >> 3; break;
-        case SPI_BAUDRATEPRESCALER_16:  spi_clk = periph_clk >> 4; break;
-        case SPI_BAUDRATEPRESCALER_32:  spi_clk = periph_clk >> 5; break;
-        case SPI_BAUDRATEPRESCALER_64:  spi_clk = periph_clk >> 6; break;
-        case SPI_BAUDRATEPRESCALER_128: spi_clk = periph_clk >> 7; break;
-        case SPI_BAUDRATEPRESCALER_256: spi_clk = periph_clk >> 8; break;
-        default:                        spi_clk = periph_clk;      break;
+      spi_clk = ptr_ro_info->ptr_rw_info->bus_speed[0];
+      for (i = 0U; i < SPI_BUS_SPEED_NUM; i++) {
+        if (spi_prescaler[i] == ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler) {
+          spi_clk = ptr_ro_info->ptr_rw_info->bus_speed[i];
+          break;
+        }
       }
       return ((int32_t)spi_clk);
 
@@ -986,6 +1947,48 @@ static int32_t SPIn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
       ptr_ro_info->ptr_rw_info->default_tx_value = arg;
       return ARM_DRIVER_OK;
 
+    case SPI_STM32_SET_POLLING_THRESHOLD:       // Set polling mode threshold; arg = max number of data items
+      if (arg > SPI_POLLING_THRESHOLD_MAX) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      ptr_ro_info->ptr_rw_info->polling_threshold = arg;
+      return ARM_DRIVER_OK;
+
+    case SPI_STM32_SET_FIFO_THRESHOLD:          // Set FIFO threshold; arg = number of data items (0 = automatic)
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+      if (arg > 16U) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      ptr_ro_info->ptr_rw_info->fifo_threshold = (uint8_t)arg;
+      return ARM_DRIVER_OK;
+#else
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+
+    case SPI_STM32_SET_DATA_PACKING:            // Enable/disable DMA data packing; arg: 0=disabled, 1=enabled
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+      ptr_ro_info->ptr_rw_info->dma_packing = (arg != 0U) ? 1U : 0U;
+      return ARM_DRIVER_OK;
+#else
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+
+    case SPI_STM32_SET_STREAM_MODE:             // Enable/disable Slave streaming mode; arg: 0=disabled, 1=enabled
+#ifdef SPI_VARIANT_DMA_CIRCULAR
+      return SPIn_SetStreamMode(ptr_ro_info, arg);
+#else
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+
+    case SPI_STM32_SET_CRC_POLYNOMIAL:          // Set CRC polynomial and enable CRC; arg = polynomial (0 = disabled)
+    case SPI_STM32_SET_CRC_LENGTH:              // Set CRC length; arg = number of bits (0 = data size)
+      return SPIn_SetCRC(ptr_ro_info, control & ARM_SPI_CONTROL_Msk, arg);
+
+    case SPI_STM32_SET_NSS_PULSE:               // Enable/disable NSS pulse between data frames; arg: 0=disabled, 1=enabled
+    case SPI_STM32_SET_SS_IDLENESS:             // Set Master SS idleness; arg = number of clock cycles
+    case SPI_STM32_SET_INTERDATA_IDLENESS:      // Set Master inter-data idleness; arg = number of clock cycles
+      return SPIn_SetFrameTiming(ptr_ro_info, control & ARM_SPI_CONTROL_Msk, arg);
+
     case ARM_SPI_CONTROL_SS:                    // Control Slave Select; arg: 0=inactive, 1=active
       if (ptr_ro_info->ptr_hspi->Init.NSS != SPI_NSS_SOFT) {
         // If slave select line is not configured as software controlled
@@ -1197,7 +2200,9 @@ static int32_t SPIn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
         }
 
         ptr_ro_info->ptr_hspi->Init.NSS      = SPI_NSS_HARD_OUTPUT;
-#ifdef  SPI_NSS_PULSE_DISABLE
+#ifdef  SPI_VARIANT_NSS_PULSE
+        ptr_ro_info->ptr_hspi->Init.NSSPMode = (ptr_ro_info->ptr_rw_info->nss_pulse != 0U) ? SPI_NSS_PULSE_ENABLE : SPI_NSS_PULSE_DISABLE;
+#elif   defined(SPI_NSS_PULSE_DISABLE)
         ptr_ro_info->ptr_hspi->Init.NSSPMode = SPI_NSS_PULSE_DISABLE;
 #endif
 
@@ -1261,47 +2266,29 @@ static int32_t SPIn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
 
   // Configure Bus Speed, only for Master mode
   if (ptr_ro_info->ptr_hspi->Init.Mode == SPI_MODE_MASTER) {
-    periph_clk = SPIn_GetPeriphClock(ptr_ro_info);
-    if (periph_clk != 0U) {
+    if (ptr_ro_info->ptr_rw_info->bus_speed[0] != 0U) {
       // If peripheral clock is valid, if peripheral clock is not valid or unknown then clock reconfiguration will be skipped
-      if      ((periph_clk >> 1) <= arg) { ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_2;   }
-      else if ((periph_clk >> 2) <= arg) { ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_4;   }
-      else if ((periph_clk >> 3) <= arg) { ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_8;   }
-      else if ((periph_clk >> 4) <= arg) { ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_16;  }
-      else if ((periph_clk >> 5) <= arg) { ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_32;  }
-      else if ((periph_clk >> 6) <= arg) { ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_64;  }
-      else if ((periph_clk >> 7) <= arg) { ptr_ro_info->ptr_hspi->Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_256; }
-      else                               { return ARM_DRIVER_ERROR;                                                   }
+      if (SPIn_SetBusSpeed(ptr_ro_info, arg) != ARM_DRIVER_OK) {
+        return ARM_DRIVER_ERROR;
+      }
     }
   }
 
   // Reconfigure DMA
+  if ((control & ARM_SPI_DATA_BITS_Msk) > ARM_SPI_DATA_BITS(16U)) {
+    dma_width = 4U;
+  } else if ((control & ARM_SPI_DATA_BITS_Msk) > ARM_SPI_DATA_BITS(8U)) {
+    dma_width = 2U;
+  } else {
+    dma_width = 1U;
+  }
+
   if (ptr_ro_info->ptr_hspi->hdmarx != NULL) {      // If DMA is used for Rx
-    if ((control & ARM_SPI_DATA_BITS_Msk) > ARM_SPI_DATA_BITS(16U)) {
-#if defined(DMA_MDATAALIGN_WORD)
-      ptr_ro_info->ptr_hspi->hdmarx->Init.MemDataAlignment    = DMA_MDATAALIGN_WORD;
-      ptr_ro_info->ptr_hspi->hdmarx->Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
-#else
-      ptr_ro_info->ptr_hspi->hdmarx->Init.SrcDataWidth        = DMA_SRC_DATAWIDTH_WORD;
-      ptr_ro_info->ptr_hspi->hdmarx->Init.DestDataWidth       = DMA_DEST_DATAWIDTH_WORD;
+    SPIn_SetDMAWidth(ptr_ro_info->ptr_hspi->hdmarx, dma_width);
+#ifdef SPI_VARIANT_DMA_CIRCULAR
+    // Configuring the mode disables Slave streaming mode
+    ptr_ro_info->ptr_hspi->hdmarx->Init.Mode = DMA_NORMAL;
 #endif
-    } else if ((control & ARM_SPI_DATA_BITS_Msk) > ARM_SPI_DATA_BITS(8U)) {
-#if defined(DMA_MDATAALIGN_HALFWORD)
-      ptr_ro_info->ptr_hspi->hdmarx->Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;
-      ptr_ro_info->ptr_hspi->hdmarx->Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
-#else
-      ptr_ro_info->ptr_hspi->hdmarx->Init.SrcDataWidth        = DMA_SRC_DATAWIDTH_HALFWORD;
-      ptr_ro_info->ptr_hspi->hdmarx->Init.DestDataWidth       = DMA_DEST_DATAWIDTH_HALFWORD;
-#endif
-    } else {
-#if defined(DMA_MDATAALIGN_BYTE)
-      ptr_ro_info->ptr_hspi->hdmarx->Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
-      ptr_ro_info->ptr_hspi->hdmarx->Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
-#else
-      ptr_ro_info->ptr_hspi->hdmarx->Init.SrcDataWidth        = DMA_SRC_DATAWIDTH_BYTE;
-      ptr_ro_info->ptr_hspi->hdmarx->Init.DestDataWidth       = DMA_DEST_DATAWIDTH_BYTE;
-#endif
-    }
 
     // Reconfigure DMA for Rx
     if (HAL_DMA_Init(ptr_ro_info->ptr_hspi->hdmarx) != HAL_OK) {
@@ -1310,31 +2297,7 @@ static int32_t SPIn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
   }
 
   if (ptr_ro_info->ptr_hspi->hdmatx != NULL) {      // If DMA is used for Tx
-    if ((control & ARM_SPI_DATA_BITS_Msk) > ARM_SPI_DATA_BITS(16U)) {
-#if defined(DMA_MDATAALIGN_WORD)
-      ptr_ro_info->ptr_hspi->hdmatx->Init.MemDataAlignment    = DMA_MDATAALIGN_WORD;
-      ptr_ro_info->ptr_hspi->hdmatx->Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
-#else
-      ptr_ro_info->ptr_hspi->hdmatx->Init.SrcDataWidth        = DMA_SRC_DATAWIDTH_WORD;
-      ptr_ro_info->ptr_hspi->hdmatx->Init.DestDataWidth       = DMA_DEST_DATAWIDTH_WORD;
-#endif
-    } else if ((control & ARM_SPI_DATA_BITS_Msk) > ARM_SPI_DATA_BITS(8U)) {
-#if defined(DMA_MDATAALIGN_HALFWORD)
-      ptr_ro_info->ptr_hspi->hdmatx->Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;
-      ptr_ro_info->ptr_hspi->hdmatx->Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
-#else
-      ptr_ro_info->ptr_hspi->hdmatx->Init.SrcDataWidth        = DMA_SRC_DATAWIDTH_HALFWORD;
-      ptr_ro_info->ptr_hspi->hdmatx->Init.DestDataWidth       = DMA_DEST_DATAWIDTH_HALFWORD;
-#endif
-    } else {
-#if defined(DMA_MDATAALIGN_BYTE)
-      ptr_ro_info->ptr_hspi->hdmatx->Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
-      ptr_ro_info->ptr_hspi->hdmatx->Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
-#else
-      ptr_ro_info->ptr_hspi->hdmatx->Init.SrcDataWidth        = DMA_SRC_DATAWIDTH_BYTE;
-      ptr_ro_info->ptr_hspi->hdmatx->Init.DestDataWidth       = DMA_DEST_DATAWIDTH_BYTE;
-#endif
-    }
+    SPIn_SetDMAWidth(ptr_ro_info->ptr_hspi->hdmatx, dma_width);
 
     // Reconfigure DMA for Tx
     if (HAL_DMA_Init(ptr_ro_info->ptr_hspi->hdmatx) != HAL_OK) {
@@ -1342,6 +2305,10 @@ static int32_t SPIn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
     }
   }
 
+#ifdef SPI_VARIANT_FIFO_THRESHOLD
+  ptr_ro_info->ptr_rw_info->dma_width = (uint8_t)dma_width;
+#endif
+
   // Reconfigure SPI
   if (HAL_SPI_Init(ptr_ro_info->ptr_hspi) != HAL_OK) {
     return ARM_DRIVER_ERROR;
@@ -1358,6 +2325,7 @@ static int32_t SPIn_Control (const RO_Info_t * const ptr_ro_info, uint32_t contr
 
   // Set driver status to configured
   ptr_ro_info->ptr_rw_info->drv_status.configured = 1U;
+  ptr_ro_info->ptr_rw_info->stream_mode           = 0U;
 
   return ARM_DRIVER_OK;
 }
@@ -1415,6 +2383,7 @@ static ARM_SPI_STATUS SPIn_GetStatus (const RO_Info_t * const ptr_ro_info) {
   */
 void HAL_SPI_TxCpltCallback (SPI_HandleTypeDef *hspi) {
   const RO_Info_t *ptr_ro_info;
+        uint32_t   event;
 
   ptr_ro_info = SPI_GetInfo(hspi);
 
@@ -1435,11 +2404,18 @@ void HAL_SPI_TxCpltCallback (SPI_HandleTypeDef *hspi) {
   if (ptr_ro_info->ptr_rw_info == NULL) {
     return;
   }
+
+  event = SPIn_NextSegment(ptr_ro_info);
+  if (event == 0U) {
+    // If next segment was started
+    return;
+  }
+
   if (ptr_ro_info->ptr_rw_info->cb_event == NULL) {
     return;
   }
 
-  ptr_ro_info->ptr_rw_info->cb_event(ARM_SPI_EVENT_TRANSFER_COMPLETE);
+  ptr_ro_info->ptr_rw_info->cb_event(event);
 }
 
 /**
@@ -1462,7 +2438,38 @@ void HAL_SPI_RxCpltCallback (SPI_HandleTypeDef *hspi) {
     return;
   }
 
-  ptr_ro_info->ptr_rw_info->cb_event(ARM_SPI_EVENT_TRANSFER_COMPLETE);
+  if (ptr_ro_info->ptr_rw_info->stream_mode != 0U) {
+    // In streaming mode second half of the ring buffer was filled, reception continues
+    ptr_ro_info->ptr_rw_info->cb_event(SPI_STM32_EVENT_STREAM_FULL);
+  } else {
+    ptr_ro_info->ptr_rw_info->cb_event(ARM_SPI_EVENT_TRANSFER_COMPLETE);
+  }
+}
+
+/**
+  \fn          void HAL_SPI_RxHalfCpltCallback (SPI_HandleTypeDef *hspi)
+  \brief       Rx Half Transfer completed callback.
+  \param[in]   hspi     SPI handle
+  */
+void HAL_SPI_RxHalfCpltCallback (SPI_HandleTypeDef *hspi) {
+  const RO_Info_t *ptr_ro_info;
+
+  ptr_ro_info = SPI_GetInfo(hspi);
+
+  if (ptr_ro_info == NULL) {
+    return;
+  }
+  if (ptr_ro_info->ptr_rw_info == NULL) {
+    return;
+  }
+  if (ptr_ro_info->ptr_rw_info->cb_event == NULL) {
+    return;
+  }
+
+  if (ptr_ro_info->ptr_rw_info->stream_mode != 0U) {
+    // In streaming mode first half of the ring buffer was filled
+    ptr_ro_info->ptr_rw_info->cb_event(SPI_STM32_EVENT_STREAM_HALF);
+  }
 }
 
 /**
@@ -1472,6 +2479,7 @@ void HAL_SPI_RxCpltCallback (SPI_HandleTypeDef *hspi) {
   */
 void HAL_SPI_TxRxCpltCallback (SPI_HandleTypeDef *hspi) {
   const RO_Info_t *ptr_ro_info;
+        uint32_t   event;
 
   ptr_ro_info = SPI_GetInfo(hspi);
 
@@ -1481,11 +2489,18 @@ void HAL_SPI_TxRxCpltCallback (SPI_HandleTypeDef *hspi) {
   if (ptr_ro_info->ptr_rw_info == NULL) {
     return;
   }
+
+  event = SPIn_NextSegment(ptr_ro_info);
+  if (event == 0U) {
+    // If next segment was started
+    return;
+  }
+
   if (ptr_ro_info->ptr_rw_info->cb_event == NULL) {
     return;
   }
 
-  ptr_ro_info->ptr_rw_info->cb_event(ARM_SPI_EVENT_TRANSFER_COMPLETE);
+  ptr_ro_info->ptr_rw_info->cb_event(event);
 }
 
 /**
@@ -1521,6 +2536,11 @@ void HAL_SPI_ErrorCallback (SPI_HandleTypeDef *hspi) {
     event |= ARM_SPI_EVENT_DATA_LOST;
   }
 
+  if ((error & HAL_SPI_ERROR_CRC) != 0U) {
+    // HAL ends the transfer with CRC error instead of calling the transfer complete callback
+    event |= SPI_STM32_EVENT_CRC_ERROR | ARM_SPI_EVENT_TRANSFER_COMPLETE;
+  }
+
   if (event != 0U) {
     ptr_ro_info->ptr_rw_info->cb_event(event);
   }
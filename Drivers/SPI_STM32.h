@@ -36,6 +36,25 @@ extern  "C"
 {
 #endif
 
+// Driver specific Control codes **********************************************
+// (values of the Control field not used by the CMSIS-Driver SPI API)
+
+#define SPI_STM32_SET_POLLING_THRESHOLD (0x80UL << ARM_SPI_CONTROL_Pos) // Set polling mode threshold; arg = max number of data items (0 = disabled, max 256)
+#define SPI_STM32_SET_FIFO_THRESHOLD    (0x81UL << ARM_SPI_CONTROL_Pos) // Set FIFO threshold; arg = number of data items (0 = automatic)
+#define SPI_STM32_SET_DATA_PACKING      (0x82UL << ARM_SPI_CONTROL_Pos) // Set DMA data packing; arg: 0 = disabled, 1 = enabled
+#define SPI_STM32_SET_STREAM_MODE       (0x83UL << ARM_SPI_CONTROL_Pos) // Set Slave streaming mode (circular DMA reception); arg: 0 = disabled, 1 = enabled
+#define SPI_STM32_SET_CRC_POLYNOMIAL    (0x84UL << ARM_SPI_CONTROL_Pos) // Set hardware CRC polynomial and enable CRC; arg = polynomial (0 = CRC disabled)
+#define SPI_STM32_SET_CRC_LENGTH        (0x85UL << ARM_SPI_CONTROL_Pos) // Set hardware CRC length; arg = number of bits (0 = same as data size)
+#define SPI_STM32_SET_NSS_PULSE         (0x86UL << ARM_SPI_CONTROL_Pos) // Set NSS pulse between data frames (hardware NSS output); arg: 0 = disabled, 1 = enabled
+#define SPI_STM32_SET_SS_IDLENESS       (0x87UL << ARM_SPI_CONTROL_Pos) // Set Master SS idleness (MSSI); arg = number of clock cycles (0 .. 15)
+#define SPI_STM32_SET_INTERDATA_IDLENESS (0x88UL << ARM_SPI_CONTROL_Pos) // Set Master inter-data idleness (MIDI); arg = number of clock cycles (0 .. 15)
+
+// Driver specific Events ******************************************************
+
+#define SPI_STM32_EVENT_STREAM_HALF     (1UL << 8)      // Streaming mode: first half of the receive buffer filled
+#define SPI_STM32_EVENT_STREAM_FULL     (1UL << 9)      // Streaming mode: second half of the receive buffer filled
+#define SPI_STM32_EVENT_CRC_ERROR       (1UL << 10)     // Received CRC does not match the calculated CRC
+
 // Global driver structures ****************************************************
 
 #ifdef  MX_SPI1
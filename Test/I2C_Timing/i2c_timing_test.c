@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     Host test of the I2C TIMINGR solver (I2C_STM32.c)
+ *
+ * Compares TIMINGR values determined by the solver of the driver with values
+ * determined by the exhaustive search over all PRESC, SCLDEL, SDADEL, SCLL and
+ * SCLH register values (as used by the driver before the solver was introduced)
+ * for a range of kernel clocks, digital filter settings, analog filter on/off,
+ * standard bus speeds and arbitrary SCL frequencies.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+// TIMINGR solver extracted from the driver source (generated at configure time)
+#include "i2c_timing_solver.h"
+
+/**
+  \fn          int32_t Ref_GetSCLRatio (ClockSetup_t *ptr_clock_setup, const StandardTiming_t *ptr_timing_spec, TimingReg_t *ptr_timing_reg)
+  \brief       Evaluate SCL low/high ratio (exhaustive search over all SCLL and SCLH values).
+  \param[in]   ptr_clock_setup    Pointer to clock setup structure
+  \param[in]   ptr_timing_spec    Pointer to standard timing specification structure
+  \param[in]   ptr_timing_reg     Pointer to Timing register values
+  \return      SCL period error
+*/
+static int32_t Ref_GetSCLRatio (ClockSetup_t *ptr_clock_setup, const StandardTiming_t *ptr_timing_spec, TimingReg_t *ptr_timing_reg) {
+  uint32_t clk_max, clk_min;
+  uint32_t tpresc, tsync;
+  uint32_t tscl, tscll, tsclh;
+  uint32_t scll, sclh;
+  int32_t  err;
+
+  // Set minimum bus clock frequency to 80% of max
+  clk_min = (ptr_timing_spec->clk_max * 80) / 100;
+  if (clk_min == 0U) {
+    clk_min = 1U;
+  }
+
+  // Convert values to ns
+  clk_max = 1000000000U / clk_min;
+  clk_min = 1000000000U / ptr_timing_spec->clk_max;
+  tsync   = ptr_clock_setup->afd_min + ptr_clock_setup->dfd + (2 * ptr_clock_setup->i2cclk);
+  tpresc  = (ptr_timing_reg->presc + 1U) * ptr_clock_setup->i2cclk;
+
+  // Evaluate all values of SCLL and SCLH
+  for (scll = 0U; scll < I2C_TIMINGR_SCLL_MAX; scll++) {
+    tscll = ((scll + 1U) * tpresc) + tsync;
+
+    if ((tscll >= ptr_timing_spec->scll_min) && (ptr_clock_setup->i2cclk < ((tscll - (ptr_clock_setup->afd_min + ptr_clock_setup->dfd)) / 4))) {
+      // SCL low meets specification
+
+      for (sclh = 0U; sclh < I2C_TIMINGR_SCLH_MAX; sclh++) {
+        tsclh = ((sclh + 1U) * tpresc) + tsync;
+
+        if ((tsclh >= ptr_timing_spec->sclh_min) && (tsclh > ptr_clock_setup->i2cclk)) {
+          // SCL high meets specification
+          tscl = tscll + tsclh;
+
+          if ((tscl >= clk_min) && (tscl <= clk_max)) {
+            // Evaluate SCL period error
+            err = (int32_t)(tscl - ptr_clock_setup->busclk);
+
+            if (err >= 0) {
+              ptr_timing_reg->sclh = (uint8_t)sclh;
+              ptr_timing_reg->scll = (uint8_t)scll;
+              return (err);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // No solution
+  return -1;
+}
+
+/**
+  \fn          uint32_t Ref_GetTimingValue (ClockSetup_t *ptr_clock_setup, const StandardTiming_t *ptr_timing_spec)
+  \brief       Calculate TIMINGR register value (exhaustive search over all PRESC, SCLDEL and SDADEL values).
+  \param[in]   ptr_clock_setup    Pointer to clock setup structure
+  \param[in]   ptr_timing_spec    Pointer to standard timing specification structure
+  \return      TIMINGR register value
+*/
+static uint32_t Ref_GetTimingValue (ClockSetup_t *ptr_clock_setup, const StandardTiming_t *ptr_timing_spec) {
+  TimingReg_t timing_reg;
+  uint32_t    presc;
+  uint32_t    sdadel, sdadel_min, sdadel_max;
+  uint32_t    scldel, scldel_min;
+  uint32_t    p, l, a;
+  uint32_t    timing;
+  int32_t     val, err;
+
+  // SDADEL limits are determined as in the driver, only the search differs
+
+  // SDADEL (max): tVD;DAT(max) - tr(max) - tAF(max) - tDNF - 4 * tI2CCLK
+  val = (int32_t)(ptr_timing_spec->vddat_max - (ptr_timing_spec->tr_max + ptr_clock_setup->afd_max + ptr_clock_setup->dfd + (4U * ptr_clock_setup->i2cclk)));
+  if (val > 0) {
+    sdadel_max = (uint32_t)val;
+  } else {
+    sdadel_max = 0U;
+  }
+
+  // SDADEL (min): tf(max) + tHD;DAT(min) - tAF(min) - tDNF - 3 * tI2CCLK
+  val = (int32_t)(ptr_timing_spec->tf_max + ptr_timing_spec->hddat_min - (ptr_clock_setup->afd_min + ptr_clock_setup->dfd + (3U * ptr_clock_setup->i2cclk)));
+  if (val > 0) {
+    sdadel_min = (uint32_t)val;
+  } else {
+    sdadel_min = 0U;
+  }
+
+  // SCLDEL (min)
+  scldel_min = ptr_timing_spec->tr_max + ptr_timing_spec->sudat_min;
+
+  // Set timing register max value
+  timing = 0xF0FFFFFFU;
+
+  // Evaluate all values of PRESC, SCLDEL and SDADEL
+  for (p = 0U; p < I2C_TIMINGR_PRESC_MAX; p++) {
+    presc = (p + 1U) * ptr_clock_setup->i2cclk;
+
+    for (l = 0U; l < I2C_TIMINGR_SCLDEL_MAX; l++) {
+      // tSCLDEL = (SCLDEL + 1U) * ((PRESC + 1U) * tI2CCLK)
+      scldel = (l + 1U) * presc;
+
+      if (scldel >= scldel_min) {
+        // SCLDEL is above low limit, evaluate SDADEL
+        for (a = 0U; a < I2C_TIMINGR_SDADEL_MAX; a++) {
+          // tSDADEL = SDADEL * ((PRESC + 1U) * tI2CCLK)
+          sdadel = a * presc;
+
+          if ((sdadel >= sdadel_min) && (sdadel <= sdadel_max)) {
+            // Valid presc (p), scldel (l) and sdadel (a)
+            timing_reg.presc  = (uint8_t)p;
+            timing_reg.scldel = (uint8_t)l;
+            timing_reg.sdadel = (uint8_t)a;
+
+            // Determine SCLL and SCLH values
+            err = Ref_GetSCLRatio(ptr_clock_setup, ptr_timing_spec, &timing_reg);
+
+            if (err >= 0) {
+              if ((uint32_t)err < ptr_clock_setup->error) {
+                ptr_clock_setup->error = (uint32_t)err;
+
+                // Save timing settings
+                timing  = (timing_reg.scll   & 0xFFU);
+                timing |= (timing_reg.sclh   & 0xFFU) <<  8;
+                timing |= (timing_reg.sdadel & 0x0FU) << 16;
+                timing |= (timing_reg.scldel & 0x0FU) << 20;
+                timing |= (timing_reg.presc  & 0x0FU) << 28;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return timing;
+}
+
+/**
+  \fn          void ClockSetup (ClockSetup_t *ptr_clock_setup, uint32_t periph_clk, uint32_t scl_freq, uint32_t anf_en, uint32_t dnf)
+  \brief       Initialize clock setup structure (as done by I2Cn_CalcTiming).
+  \param[out]  ptr_clock_setup  Pointer to clock setup structure
+  \param[in]   periph_clk       Peripheral clock frequency (in Hz)
+  \param[in]   scl_freq         Requested SCL frequency (in Hz)
+  \param[in]   anf_en           Analog noise filter enable
+  \param[in]   dnf              Digital noise filter coefficient value (0 - disabled)
+*/
+static void ClockSetup (ClockSetup_t *ptr_clock_setup, uint32_t periph_clk, uint32_t scl_freq, uint32_t anf_en, uint32_t dnf) {
+
+  ptr_clock_setup->i2cclk = (1000000000U + (periph_clk / 2)) / periph_clk;
+  ptr_clock_setup->busclk = (1000000000U + (scl_freq   / 2)) / scl_freq;
+  ptr_clock_setup->dfd    = ptr_clock_setup->i2cclk * dnf;
+
+  if (anf_en != 0U) {
+    ptr_clock_setup->afd_min = I2C_ANALOG_FILTER_DELAY_MIN;
+    ptr_clock_setup->afd_max = I2C_ANALOG_FILTER_DELAY_MAX;
+  } else {
+    ptr_clock_setup->afd_min = 0U;
+    ptr_clock_setup->afd_max = 0U;
+  }
+
+  ptr_clock_setup->error = 0xFFFFFFFFU;
+}
+
+/**
+  \fn          uint32_t CompareTiming (uint32_t periph_clk, const StandardTiming_t *ptr_timing_spec, uint32_t scl_freq, uint32_t anf_en, uint32_t dnf)
+  \brief       Compare TIMINGR value of the solver with the exhaustive search.
+  \param[in]   periph_clk       Peripheral clock frequency (in Hz)
+  \param[in]   ptr_timing_spec  Pointer to I2C timing specification
+  \param[in]   scl_freq         Requested SCL frequency (in Hz)
+  \param[in]   anf_en           Analog noise filter enable
+  \param[in]   dnf              Digital noise filter coefficient value (0 - disabled)
+  \return      0 if values are identical, 1 otherwise
+*/
+static uint32_t CompareTiming (uint32_t periph_clk, const StandardTiming_t *ptr_timing_spec, uint32_t scl_freq, uint32_t anf_en, uint32_t dnf) {
+  ClockSetup_t setup_solver, setup_ref;
+  uint32_t     timing_solver, timing_ref;
+
+  ClockSetup(&setup_solver, periph_clk, scl_freq, anf_en, dnf);
+  ClockSetup(&setup_ref,    periph_clk, scl_freq, anf_en, dnf);
+
+  timing_solver = I2Cn_GetTimingValue(&setup_solver, ptr_timing_spec);
+  timing_ref    = Ref_GetTimingValue (&setup_ref,    ptr_timing_spec);
+
+  // No valid setting: TIMINGR value is not used, only the error has to match
+  if ((setup_solver.error == 0xFFFFFFFFU) && (setup_ref.error == 0xFFFFFFFFU)) {
+    return 0U;
+  }
+
+  if ((timing_solver != timing_ref) || (setup_solver.error != setup_ref.error)) {
+    printf("FAIL: periph_clk=%lu Hz, scl_freq=%lu Hz, anf=%lu, dnf=%lu: solver 0x%08lX (error %lu ns), exhaustive 0x%08lX (error %lu ns)\n",
+           (unsigned long)periph_clk, (unsigned long)scl_freq, (unsigned long)anf_en, (unsigned long)dnf,
+           (unsigned long)timing_solver, (unsigned long)setup_solver.error,
+           (unsigned long)timing_ref,    (unsigned long)setup_ref.error);
+    return 1U;
+  }
+
+  return 0U;
+}
+
+// Kernel clocks commonly used for the I2C peripheral (in Hz)
+static const uint32_t periph_clk_list[] = {
+    4000000U,   8000000U,  12000000U,  16000000U,  24000000U,  25000000U,  32000000U,  48000000U,
+   50000000U,  54000000U,  60000000U,  64000000U,  72000000U,  80000000U,  84000000U,  96000000U,
+  100000000U, 108000000U, 120000000U, 125000000U, 160000000U, 168000000U, 170000000U, 180000000U,
+  200000000U, 216000000U, 240000000U, 250000000U, 275000000U, 280000000U, 400000000U, 480000000U,
+  520000000U, 550000000U, 600000000U
+};
+
+// Arbitrary SCL frequencies (in Hz), timing specification of the lowest speed class including the frequency is used
+static const uint32_t scl_freq_list[] = {
+  1000U, 10000U, 50000U, 250000U, 333000U, 700000U
+};
+
+int main (void) {
+  const StandardTiming_t *spec_list[] = { &i2c_spec_standard, &i2c_spec_fast, &i2c_spec_fast_plus };
+  StandardTiming_t        timing_spec;
+  uint32_t                periph_clk, anf_en, dnf, i, j;
+  uint32_t                num, fail;
+
+  num  = 0U;
+  fail = 0U;
+
+  for (anf_en = 0U; anf_en < 2U; anf_en++) {
+    for (dnf = 0U; dnf <= 15U; dnf++) {
+      // Standard bus speeds with kernel clocks from 1 to 600 MHz in 7 MHz steps
+      for (periph_clk = 1000000U; periph_clk <= 600000000U; periph_clk += 7000000U) {
+        for (i = 0U; i < (sizeof(spec_list) / sizeof(spec_list[0])); i++) {
+          fail += CompareTiming(periph_clk, spec_list[i], spec_list[i]->clk_max, anf_en, dnf);
+          num++;
+        }
+      }
+
+      // Standard bus speeds with common kernel clocks
+      for (i = 0U; i < (sizeof(periph_clk_list) / sizeof(periph_clk_list[0])); i++) {
+        for (j = 0U; j < (sizeof(spec_list) / sizeof(spec_list[0])); j++) {
+          fail += CompareTiming(periph_clk_list[i], spec_list[j], spec_list[j]->clk_max, anf_en, dnf);
+          num++;
+        }
+      }
+    }
+
+    // Arbitrary SCL frequencies with common kernel clocks, without and with max digital filter
+    // (exhaustive search is slow for low frequencies, so not all filter settings are evaluated)
+    for (dnf = 0U; dnf <= 15U; dnf += 15U) {
+      for (i = 0U; i < (sizeof(periph_clk_list) / sizeof(periph_clk_list[0])); i++) {
+        for (j = 0U; j < (sizeof(scl_freq_list) / sizeof(scl_freq_list[0])); j++) {
+          if (scl_freq_list[j] <= i2c_spec_standard.clk_max) {
+            timing_spec = i2c_spec_standard;
+          } else if (scl_freq_list[j] <= i2c_spec_fast.clk_max) {
+            timing_spec = i2c_spec_fast;
+          } else {
+            timing_spec = i2c_spec_fast_plus;
+          }
+          timing_spec.clk_max = scl_freq_list[j];
+
+          fail += CompareTiming(periph_clk_list[i], &timing_spec, scl_freq_list[j], anf_en, dnf);
+          num++;
+        }
+      }
+    }
+  }
+
+  printf("%lu of %lu configurations identical\n", (unsigned long)(num - fail), (unsigned long)num);
+
+  return (fail == 0U) ? 0 : 1;
+}